@@ -0,0 +1,146 @@
+//! Criterion benchmarks for the library's hot paths
+//!
+//! Covers the work done per WebSocket frame and per FFI call: Mattermost →
+//! generic type conversion, serde_json serialization of message arrays,
+//! cache get/insert under contention, and WebSocket event parse + convert.
+//! Run with `cargo bench`. The companion C program `examples/ffi_bench.c`
+//! measures the same paths end to end through the FFI boundary.
+
+use std::sync::Arc;
+use std::time::Duration;
+
+use criterion::{criterion_group, criterion_main, BenchmarkId, Criterion};
+
+use communicator::platforms::mattermost::{
+    Cache, MattermostChannel, MattermostPost, MattermostUser, WebSocketEvent,
+};
+use communicator::types::{Channel, Message, User};
+
+/// A realistic `posted` frame captured from a Mattermost server
+const POSTED_FRAME: &str = r#"{"event": "posted", "data": {"channel_display_name":"@jay","channel_name":"t1pn9rb63fnpjrqibgriijcx4r__xei6dqz8xfgm7kqzddjziyofyo","channel_type":"D","post":"{\"id\":\"a4aurxyyc3yruntz4zfmdw75nr\",\"create_at\":1761422860825,\"update_at\":1761422860825,\"edit_at\":0,\"delete_at\":0,\"is_pinned\":false,\"user_id\":\"t1pn9rb63fnpjrqibgriijcx4r\",\"channel_id\":\"4ckrmjaeeb8mbpodbmo6bknpge\",\"root_id\":\"\",\"original_id\":\"\",\"message\":\"aweff\",\"type\":\"\",\"props\":{\"disable_group_highlight\":true},\"hashtags\":\"\",\"file_ids\":[],\"pending_post_id\":\"t1pn9rb63fnpjrqibgriijcx4r:1761422860771\",\"remote_id\":\"\",\"reply_count\":0,\"last_reply_at\":0,\"participants\":null,\"metadata\":{}}","sender_name":"@jay","set_online":true,"team_id":""}, "broadcast": {"omit_users":null,"user_id":"","channel_id":"4ckrmjaeeb8mbpodbmo6bknpge","team_id":"","connection_id":"","omit_connection_id":""}, "seq": 35}"#;
+
+const POST_JSON: &str = r#"{"id":"a4aurxyyc3yruntz4zfmdw75nr","create_at":1761422860825,"update_at":1761422860825,"edit_at":0,"delete_at":0,"user_id":"t1pn9rb63fnpjrqibgriijcx4r","channel_id":"4ckrmjaeeb8mbpodbmo6bknpge","message":"benchmark message body with a typical length for chat traffic","type":""}"#;
+
+const USER_JSON: &str = r#"{"id":"user1","create_at":0,"update_at":0,"delete_at":0,"username":"jay","first_name":"Jay","last_name":"Doe","nickname":"jay","email":"jay@example.com","roles":"system_user"}"#;
+
+const CHANNEL_JSON: &str = r#"{"id":"chan1","create_at":0,"update_at":0,"delete_at":0,"team_id":"team1","type":"O","display_name":"Town Square","name":"town-square","header":"","purpose":"General discussion","last_post_at":0,"total_msg_count":0,"creator_id":"user1"}"#;
+
+fn bench_type_conversions(c: &mut Criterion) {
+    let post: MattermostPost = serde_json::from_str(POST_JSON).unwrap();
+    let user: MattermostUser = serde_json::from_str(USER_JSON).unwrap();
+    let channel: MattermostChannel = serde_json::from_str(CHANNEL_JSON).unwrap();
+
+    let mut group = c.benchmark_group("convert");
+    group.bench_function("post_to_message", |b| {
+        b.iter(|| Message::from(std::hint::black_box(post.clone())))
+    });
+    group.bench_function("user_to_user", |b| {
+        b.iter(|| User::from(std::hint::black_box(user.clone())))
+    });
+    group.bench_function("channel_to_channel", |b| {
+        b.iter(|| Channel::from(std::hint::black_box(channel.clone())))
+    });
+    group.finish();
+}
+
+fn bench_message_serialization(c: &mut Criterion) {
+    let post: MattermostPost = serde_json::from_str(POST_JSON).unwrap();
+    let message = Message::from(post);
+
+    let mut group = c.benchmark_group("serialize_messages");
+    for size in [10usize, 100, 1000] {
+        let messages: Vec<Message> = (0..size).map(|_| message.clone()).collect();
+        group.bench_with_input(
+            BenchmarkId::from_parameter(size),
+            &messages,
+            |b, messages| b.iter(|| serde_json::to_string(std::hint::black_box(messages)).unwrap()),
+        );
+    }
+    group.finish();
+}
+
+fn bench_cache(c: &mut Criterion) {
+    let rt = tokio::runtime::Runtime::new().unwrap();
+
+    let mut group = c.benchmark_group("cache");
+
+    group.bench_function("get_hit", |b| {
+        let cache: Cache<String> = Cache::new(Duration::from_secs(300));
+        rt.block_on(cache.set("key".to_string(), "value".to_string()));
+        b.to_async(&rt)
+            .iter(|| async { std::hint::black_box(cache.get("key").await) });
+    });
+
+    group.bench_function("insert", |b| {
+        let cache: Cache<String> = Cache::new(Duration::from_secs(300));
+        let mut i = 0u64;
+        b.to_async(&rt).iter(|| {
+            i += 1;
+            let key = format!("key{}", i % 1024);
+            let cache = &cache;
+            async move { cache.set(key, "value".to_string()).await }
+        });
+    });
+
+    // 8 tasks hammering a shared cache with a 3:1 read/write mix over a
+    // small hot key set, the shape of a posted-event burst
+    group.bench_function("contended_get_set_8_tasks", |b| {
+        b.to_async(&rt).iter(|| async {
+            let cache: Arc<Cache<String>> = Arc::new(Cache::new(Duration::from_secs(300)));
+            let mut handles = Vec::new();
+            for task in 0..8u64 {
+                let cache = Arc::clone(&cache);
+                handles.push(tokio::spawn(async move {
+                    for i in 0..64u64 {
+                        let key = format!("key{}", (task * 64 + i) % 32);
+                        if i % 4 == 0 {
+                            cache.set(key, "value".to_string()).await;
+                        } else {
+                            std::hint::black_box(cache.get(&key).await);
+                        }
+                    }
+                }));
+            }
+            for handle in handles {
+                handle.await.unwrap();
+            }
+        });
+    });
+
+    group.finish();
+}
+
+fn bench_websocket_event(c: &mut Criterion) {
+    let mut group = c.benchmark_group("websocket");
+
+    group.bench_function("parse_posted_frame", |b| {
+        b.iter(|| {
+            let event: WebSocketEvent =
+                serde_json::from_str(std::hint::black_box(POSTED_FRAME)).unwrap();
+            event
+        })
+    });
+
+    // Parse plus the conversion work done for a posted event: extract the
+    // JSON-encoded post string, deserialize it, and convert to a Message
+    group.bench_function("parse_and_convert_posted_frame", |b| {
+        b.iter(|| {
+            let event: WebSocketEvent =
+                serde_json::from_str(std::hint::black_box(POSTED_FRAME)).unwrap();
+            let post_str = event.data.get("post").and_then(|v| v.as_str()).unwrap();
+            let post: MattermostPost = serde_json::from_str(post_str).unwrap();
+            Message::from(post)
+        })
+    });
+
+    group.finish();
+}
+
+criterion_group!(
+    benches,
+    bench_type_conversions,
+    bench_message_serialization,
+    bench_cache,
+    bench_websocket_event
+);
+criterion_main!(benches);
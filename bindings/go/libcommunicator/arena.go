@@ -0,0 +1,77 @@
+package libcommunicator
+
+/*
+#include <communicator.h>
+#include <stdlib.h>
+*/
+import "C"
+import "runtime"
+
+// Arena batches the allocation and freeing of strings returned by the
+// library. While an arena is current on a thread, returned strings are
+// owned by the arena and freed together by Reset or Destroy instead of
+// one communicator_free_string call each.
+//
+// The Go bindings copy every returned string into Go memory before
+// returning, so an arena is purely an allocator optimization for bursts
+// of calls. Because arenas are installed per OS thread, pin the
+// goroutine with runtime.LockOSThread() while one is current
+type Arena struct {
+	handle C.CommunicatorArena
+}
+
+// NewArena creates a new string arena
+func NewArena() (*Arena, error) {
+	handle := C.communicator_arena_create()
+	if handle == nil {
+		return nil, getLastError()
+	}
+
+	arena := &Arena{handle: handle}
+	runtime.SetFinalizer(arena, func(a *Arena) {
+		a.Destroy()
+	})
+
+	return arena, nil
+}
+
+// SetCurrent installs the arena as the current one for the calling OS
+// thread; the arena must stay alive while installed
+func (a *Arena) SetCurrent() error {
+	if a.handle == nil {
+		return newError(ErrorInvalidState, "invalid arena handle")
+	}
+
+	code := C.communicator_arena_set_current(a.handle)
+	if code != C.COMMUNICATOR_SUCCESS {
+		return getLastError()
+	}
+
+	return nil
+}
+
+// ClearCurrentArena clears the calling OS thread's current arena,
+// returning to per-string ownership
+func ClearCurrentArena() error {
+	code := C.communicator_arena_set_current(nil)
+	if code != C.COMMUNICATOR_SUCCESS {
+		return getLastError()
+	}
+
+	return nil
+}
+
+// Reset frees every string owned by the arena, keeping it reusable
+func (a *Arena) Reset() {
+	if a.handle != nil {
+		C.communicator_arena_reset(a.handle)
+	}
+}
+
+// Destroy destroys the arena and frees every string it owns
+func (a *Arena) Destroy() {
+	if a.handle != nil {
+		C.communicator_arena_destroy(a.handle)
+		a.handle = nil
+	}
+}
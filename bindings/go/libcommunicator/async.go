@@ -0,0 +1,165 @@
+package libcommunicator
+
+/*
+#include <communicator.h>
+#include <stdlib.h>
+
+extern void goSendCallbackBridge(uint64_t request_id, char* message_json, CommunicatorErrorCode error_code, void* user_data);
+extern void goSendFailureCallbackBridge(char* channel_id, char* text, CommunicatorErrorCode error_code, void* user_data);
+
+static uint64_t go_send_message_async(CommunicatorPlatform platform, const char* channel_id, const char* text, uintptr_t user_data) {
+	return communicator_platform_send_message_async(
+		platform, channel_id, text, (CommunicatorSendCallback)goSendCallbackBridge, (void*)user_data);
+}
+
+static uint64_t go_send_reply_async(CommunicatorPlatform platform, const char* channel_id, const char* text, const char* root_id, uintptr_t user_data) {
+	return communicator_platform_send_reply_async(
+		platform, channel_id, text, root_id, (CommunicatorSendCallback)goSendCallbackBridge, (void*)user_data);
+}
+
+static CommunicatorErrorCode go_set_send_failure_callback(CommunicatorPlatform platform, uintptr_t user_data) {
+	return communicator_platform_set_callback_send_failure(
+		platform, (CommunicatorSendFailureCallback)goSendFailureCallbackBridge, (void*)user_data);
+}
+
+static CommunicatorErrorCode go_clear_send_failure_callback(CommunicatorPlatform platform) {
+	return communicator_platform_set_callback_send_failure(platform, NULL, NULL);
+}
+*/
+import "C"
+import (
+	"runtime/cgo"
+)
+
+// SendResultCallback receives the outcome of an async send
+// It is invoked exactly once on a library runtime thread; message is nil
+// when the send failed, and err is nil when it succeeded
+type SendResultCallback func(requestID uint64, message *Message, err error)
+
+// SendFailureCallback receives terminal outbound queue failures
+// It is invoked on a library runtime thread after an enqueued message
+// has exhausted its retries or failed non-transiently
+type SendFailureCallback func(channelID, text string, err error)
+
+// SetAsyncSendLimit sets the maximum number of concurrent async send
+// requests. Applies to requests started after this call; defaults to 16
+func SetAsyncSendLimit(limit int) error {
+	code := C.communicator_set_async_send_limit(C.size_t(limit))
+	if code != C.COMMUNICATOR_SUCCESS {
+		return getLastError()
+	}
+	return nil
+}
+
+// SendMessageAsync sends a message without blocking the calling goroutine
+// The request executes on the library's internal runtime, bounded by the
+// async send limit. Returns the request ID for correlating the callback
+func (p *Platform) SendMessageAsync(channelID, text string, callback SendResultCallback) (uint64, error) {
+	if p.handle == nil {
+		return 0, ErrInvalidHandle
+	}
+	if callback == nil {
+		return 0, newError(ErrorInvalidArg, "callback must not be nil")
+	}
+
+	csChannelID, freeChannelID := cStringFree(channelID)
+	defer freeChannelID()
+
+	csText, freeText := cStringFree(text)
+	defer freeText()
+
+	handle := cgo.NewHandle(callback)
+	requestID := C.go_send_message_async(p.handle, csChannelID, csText, C.uintptr_t(handle))
+	if requestID == 0 {
+		handle.Delete()
+		return 0, getLastError()
+	}
+
+	return uint64(requestID), nil
+}
+
+// SendReplyAsync sends a threaded reply without blocking the calling
+// goroutine; see SendMessageAsync for callback semantics
+func (p *Platform) SendReplyAsync(channelID, text, rootID string, callback SendResultCallback) (uint64, error) {
+	if p.handle == nil {
+		return 0, ErrInvalidHandle
+	}
+	if callback == nil {
+		return 0, newError(ErrorInvalidArg, "callback must not be nil")
+	}
+
+	csChannelID, freeChannelID := cStringFree(channelID)
+	defer freeChannelID()
+
+	csText, freeText := cStringFree(text)
+	defer freeText()
+
+	csRootID, freeRootID := cStringFree(rootID)
+	defer freeRootID()
+
+	handle := cgo.NewHandle(callback)
+	requestID := C.go_send_reply_async(p.handle, csChannelID, csText, csRootID, C.uintptr_t(handle))
+	if requestID == 0 {
+		handle.Delete()
+		return 0, getLastError()
+	}
+
+	return uint64(requestID), nil
+}
+
+// EnqueueMessage queues a message for background delivery
+// Returns as soon as the message is queued. A background task delivers it
+// with per-channel ordering, retrying transient failures with exponential
+// backoff; terminal failures are reported through the callback registered
+// with SetSendFailureCallback and the message is dropped
+func (p *Platform) EnqueueMessage(channelID, text string) error {
+	if p.handle == nil {
+		return ErrInvalidHandle
+	}
+
+	csChannelID, freeChannelID := cStringFree(channelID)
+	defer freeChannelID()
+
+	csText, freeText := cStringFree(text)
+	defer freeText()
+
+	code := C.communicator_platform_enqueue_message(p.handle, csChannelID, csText)
+	if code != C.COMMUNICATOR_SUCCESS {
+		return getLastError()
+	}
+
+	return nil
+}
+
+// SetSendFailureCallback registers a callback for terminal outbound
+// queue failures; passing nil clears it
+func (p *Platform) SetSendFailureCallback(callback SendFailureCallback) error {
+	if p.handle == nil {
+		return ErrInvalidHandle
+	}
+
+	if callback == nil {
+		code := C.go_clear_send_failure_callback(p.handle)
+		if code != C.COMMUNICATOR_SUCCESS {
+			return getLastError()
+		}
+		if p.sendFailureCallback != 0 {
+			p.sendFailureCallback.Delete()
+			p.sendFailureCallback = 0
+		}
+		return nil
+	}
+
+	handle := cgo.NewHandle(callback)
+	code := C.go_set_send_failure_callback(p.handle, C.uintptr_t(handle))
+	if code != C.COMMUNICATOR_SUCCESS {
+		handle.Delete()
+		return getLastError()
+	}
+
+	if p.sendFailureCallback != 0 {
+		p.sendFailureCallback.Delete()
+	}
+	p.sendFailureCallback = handle
+	return nil
+}
@@ -0,0 +1,89 @@
+package libcommunicator
+
+/*
+#include <communicator.h>
+#include <stdlib.h>
+*/
+import "C"
+import "encoding/json"
+
+// SaveCacheSnapshot writes the platform's cache contents to a snapshot
+// file, letting the next session start warm instead of refetching
+// everything
+func (p *Platform) SaveCacheSnapshot(path string) error {
+	if p.handle == nil {
+		return ErrInvalidHandle
+	}
+
+	cs, free := cStringFree(path)
+	defer free()
+
+	code := C.communicator_platform_save_cache_snapshot(p.handle, cs)
+	if code != C.COMMUNICATOR_SUCCESS {
+		return getLastError()
+	}
+
+	return nil
+}
+
+// LoadCacheSnapshot loads the platform's cache contents from a snapshot
+// file; call after connecting for a warm start
+func (p *Platform) LoadCacheSnapshot(path string) error {
+	if p.handle == nil {
+		return ErrInvalidHandle
+	}
+
+	cs, free := cStringFree(path)
+	defer free()
+
+	code := C.communicator_platform_load_cache_snapshot(p.handle, cs)
+	if code != C.COMMUNICATOR_SUCCESS {
+		return getLastError()
+	}
+
+	return nil
+}
+
+// GetCacheStats returns cache statistics as a JSON string mapping cache
+// names to hit, miss, and eviction counters
+func (p *Platform) GetCacheStats() (string, error) {
+	if p.handle == nil {
+		return "", ErrInvalidHandle
+	}
+
+	cstr := C.communicator_platform_get_cache_stats(p.handle)
+	if cstr == nil {
+		return "", getLastError()
+	}
+	defer freeString(cstr)
+
+	return C.GoString(cstr), nil
+}
+
+// GetUserStatusCached returns a user's status from the local status
+// cache without a network round trip
+// Returns "online", "away", "dnd", "offline", or "unknown" when no
+// status has been observed yet
+func (p *Platform) GetUserStatusCached(userID string) (string, error) {
+	if p.handle == nil {
+		return "", ErrInvalidHandle
+	}
+
+	cs, free := cStringFree(userID)
+	defer free()
+
+	cstr := C.communicator_platform_get_user_status_cached(p.handle, cs)
+	if cstr == nil {
+		return "", getLastError()
+	}
+	defer freeString(cstr)
+
+	var statusResponse struct {
+		Status string `json:"status"`
+	}
+	if err := json.Unmarshal([]byte(C.GoString(cstr)), &statusResponse); err != nil {
+		return "", err
+	}
+
+	return statusResponse.Status, nil
+}
@@ -0,0 +1,142 @@
+package libcommunicator
+
+/*
+#include <communicator.h>
+#include <stdlib.h>
+
+extern void goEventCallbackBridge(char* event_json, void* user_data);
+
+static CommunicatorErrorCode go_set_event_callback(CommunicatorPlatform platform, uintptr_t user_data) {
+	return communicator_platform_set_event_callback(
+		platform, (CommunicatorEventCallback)goEventCallbackBridge, (void*)user_data);
+}
+
+static CommunicatorErrorCode go_clear_event_callback(CommunicatorPlatform platform) {
+	return communicator_platform_set_event_callback(platform, NULL, NULL);
+}
+*/
+import "C"
+import (
+	"encoding/json"
+	"runtime/cgo"
+	"time"
+	"unsafe"
+)
+
+// EventCallback handles an event delivered in push mode
+// It is invoked on a library runtime thread and must be cheap and
+// non-blocking; hand heavy work off to a goroutine
+type EventCallback func(*Event)
+
+// SetEventCallback registers a callback for push-mode event delivery
+// While a callback is registered, events are delivered directly from the
+// library's runtime instead of being queued for PollEvent/PollEventsBatch
+// Passing nil clears the callback and returns to poll mode
+func (p *Platform) SetEventCallback(callback EventCallback) error {
+	if p.handle == nil {
+		return ErrInvalidHandle
+	}
+
+	if callback == nil {
+		return p.ClearEventCallback()
+	}
+
+	handle := cgo.NewHandle(callback)
+	code := C.go_set_event_callback(p.handle, C.uintptr_t(handle))
+	if code != C.COMMUNICATOR_SUCCESS {
+		handle.Delete()
+		return getLastError()
+	}
+
+	if p.eventCallback != 0 {
+		p.eventCallback.Delete()
+	}
+	p.eventCallback = handle
+	return nil
+}
+
+// ClearEventCallback clears the push-mode event callback, returning the
+// platform to poll mode
+func (p *Platform) ClearEventCallback() error {
+	if p.handle == nil {
+		return ErrInvalidHandle
+	}
+
+	code := C.go_clear_event_callback(p.handle)
+	if code != C.COMMUNICATOR_SUCCESS {
+		return getLastError()
+	}
+
+	if p.eventCallback != 0 {
+		p.eventCallback.Delete()
+		p.eventCallback = 0
+	}
+	return nil
+}
+
+// SetEventFilter sets a subscription filter for incoming events
+// Filtered events are dropped before full deserialization and never
+// occupy the event queue. eventTypes holds platform-native event type
+// names (e.g. "posted", "post_edited"); nil accepts all types. channelIDs
+// restricts delivery to those channels; nil accepts all channels. Pass
+// nil for both to clear the filter
+func (p *Platform) SetEventFilter(eventTypes, channelIDs []string) error {
+	if p.handle == nil {
+		return ErrInvalidHandle
+	}
+
+	var cTypes, cChannels *C.char
+	if eventTypes != nil {
+		jsonBytes, err := json.Marshal(eventTypes)
+		if err != nil {
+			return err
+		}
+		cTypes = C.CString(string(jsonBytes))
+		defer C.free(unsafe.Pointer(cTypes))
+	}
+	if channelIDs != nil {
+		jsonBytes, err := json.Marshal(channelIDs)
+		if err != nil {
+			return err
+		}
+		cChannels = C.CString(string(jsonBytes))
+		defer C.free(unsafe.Pointer(cChannels))
+	}
+
+	code := C.communicator_platform_set_event_filter(p.handle, cTypes, cChannels)
+	if code != C.COMMUNICATOR_SUCCESS {
+		return getLastError()
+	}
+
+	return nil
+}
+
+// OverflowPolicy selects what happens when the event queue is full
+type OverflowPolicy int
+
+const (
+	// OverflowDropNewest drops the incoming event (default)
+	OverflowDropNewest OverflowPolicy = 0
+	// OverflowDropOldest evicts the oldest queued event to make room
+	OverflowDropOldest OverflowPolicy = 1
+	// OverflowBlockWithTimeout blocks the reader task up to the timeout,
+	// then drops the incoming event
+	OverflowBlockWithTimeout OverflowPolicy = 2
+)
+
+// SetQueueOverflowPolicy sets the policy applied when the event queue
+// overflows. timeout is only used with OverflowBlockWithTimeout. Dropped
+// events are counted per event type in the metrics from GetMetrics
+func (p *Platform) SetQueueOverflowPolicy(policy OverflowPolicy, timeout time.Duration) error {
+	if p.handle == nil {
+		return ErrInvalidHandle
+	}
+
+	code := C.communicator_platform_set_queue_overflow_policy(
+		p.handle, C.int(policy), C.uint64_t(timeout.Milliseconds()))
+	if code != C.COMMUNICATOR_SUCCESS {
+		return getLastError()
+	}
+
+	return nil
+}
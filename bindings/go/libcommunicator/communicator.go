@@ -97,6 +97,18 @@ func getLastError() error {
 	return fmt.Errorf("libcommunicator error %d: %s", code, C.GoString(msg))
 }
 
+// errorFromCode converts a library error code to a Go error
+// Returns nil for Success; used where only the code crosses the FFI
+// boundary (callback invocations), so no detailed message is available
+func errorFromCode(code ErrorCode) error {
+	if code == Success {
+		return nil
+	}
+
+	codeStr := C.communicator_error_code_string(C.CommunicatorErrorCode(code))
+	return &LibError{Code: code, Message: C.GoString(codeStr)}
+}
+
 // clearError clears the last error
 func clearError() {
 	C.communicator_clear_error()
@@ -0,0 +1,78 @@
+package libcommunicator
+
+/*
+#include <communicator.h>
+#include <stdlib.h>
+*/
+import "C"
+import (
+	"encoding/json"
+	"runtime"
+)
+
+// MessageCursor pages backwards through a channel's message history,
+// prefetching the next page in the background while the caller processes
+// the current one
+type MessageCursor struct {
+	handle C.CommunicatorMessageCursor
+}
+
+// OpenMessageCursor opens a cursor over a channel's message history
+// pageSize is the number of messages per page and must be greater than
+// zero. Close the cursor when done
+func (p *Platform) OpenMessageCursor(channelID string, pageSize uint32) (*MessageCursor, error) {
+	if p.handle == nil {
+		return nil, ErrInvalidHandle
+	}
+
+	cs, free := cStringFree(channelID)
+	defer free()
+
+	handle := C.communicator_platform_open_message_cursor(p.handle, cs, C.uint32_t(pageSize))
+	if handle == nil {
+		return nil, getLastError()
+	}
+
+	cursor := &MessageCursor{handle: handle}
+	runtime.SetFinalizer(cursor, func(c *MessageCursor) {
+		c.Close()
+	})
+
+	return cursor, nil
+}
+
+// Next returns the next page of messages, newest first within the page
+// Returns (nil, nil) when the history is exhausted
+func (c *MessageCursor) Next() ([]Message, error) {
+	if c.handle == nil {
+		return nil, ErrInvalidHandle
+	}
+
+	// A nil result with no error set means end of history, so clear any
+	// stale error before the call to tell the two apart
+	clearError()
+
+	cstr := C.communicator_message_cursor_next(c.handle)
+	if cstr == nil {
+		if err := getLastError(); err != nil {
+			return nil, err
+		}
+		return nil, nil
+	}
+	defer freeString(cstr)
+
+	var messages []Message
+	if err := json.Unmarshal([]byte(C.GoString(cstr)), &messages); err != nil {
+		return nil, err
+	}
+
+	return messages, nil
+}
+
+// Close frees the cursor, aborting any still-running prefetch
+func (c *MessageCursor) Close() {
+	if c.handle != nil {
+		C.communicator_message_cursor_free(c.handle)
+		c.handle = nil
+	}
+}
@@ -0,0 +1,87 @@
+package libcommunicator
+
+/*
+#include <communicator.h>
+*/
+import "C"
+import (
+	"encoding/json"
+	"runtime/cgo"
+	"unsafe"
+)
+
+// Bridges invoked by the library on its internal runtime threads. The
+// user_data pointer always carries a cgo.Handle to the registered Go
+// callback; string and byte arguments are only valid for the duration of
+// the call and are copied into Go memory before the bridge returns.
+//
+// This file must contain only the exported bridge functions: cgo forbids
+// C definitions in the preamble of a file that uses //export, so the
+// static helpers that cast these bridges to the library's callback
+// typedefs live in the files that register them.
+
+//export goEventCallbackBridge
+func goEventCallbackBridge(eventJSON *C.char, userData unsafe.Pointer) {
+	callback, ok := cgo.Handle(uintptr(userData)).Value().(EventCallback)
+	if !ok {
+		return
+	}
+
+	var event Event
+	if err := json.Unmarshal([]byte(C.GoString(eventJSON)), &event); err != nil {
+		return
+	}
+	callback(&event)
+}
+
+//export goSendCallbackBridge
+func goSendCallbackBridge(requestID C.uint64_t, messageJSON *C.char, errorCode C.CommunicatorErrorCode, userData unsafe.Pointer) {
+	// Async sends fire their callback exactly once, so the handle is
+	// released here rather than by the caller
+	handle := cgo.Handle(uintptr(userData))
+	defer handle.Delete()
+
+	callback, ok := handle.Value().(SendResultCallback)
+	if !ok {
+		return
+	}
+
+	var message *Message
+	if messageJSON != nil {
+		var m Message
+		if err := json.Unmarshal([]byte(C.GoString(messageJSON)), &m); err == nil {
+			message = &m
+		}
+	}
+	callback(uint64(requestID), message, errorFromCode(ErrorCode(errorCode)))
+}
+
+//export goSendFailureCallbackBridge
+func goSendFailureCallbackBridge(channelID *C.char, text *C.char, errorCode C.CommunicatorErrorCode, userData unsafe.Pointer) {
+	callback, ok := cgo.Handle(uintptr(userData)).Value().(SendFailureCallback)
+	if !ok {
+		return
+	}
+	callback(C.GoString(channelID), C.GoString(text), errorFromCode(ErrorCode(errorCode)))
+}
+
+//export goUploadProgressBridge
+func goUploadProgressBridge(bytesSent C.uint64_t, totalBytes C.uint64_t, userData unsafe.Pointer) {
+	callback, ok := cgo.Handle(uintptr(userData)).Value().(UploadProgressCallback)
+	if !ok {
+		return
+	}
+	callback(uint64(bytesSent), uint64(totalBytes))
+}
+
+//export goDownloadChunkBridge
+func goDownloadChunkBridge(data *C.uint8_t, size C.size_t, userData unsafe.Pointer) C.int32_t {
+	callback, ok := cgo.Handle(uintptr(userData)).Value().(DownloadChunkCallback)
+	if !ok {
+		return 0
+	}
+	if callback(C.GoBytes(unsafe.Pointer(data), C.int(size))) {
+		return 1
+	}
+	return 0
+}
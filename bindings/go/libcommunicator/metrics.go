@@ -0,0 +1,41 @@
+package libcommunicator
+
+/*
+#include <communicator.h>
+#include <stdlib.h>
+*/
+import "C"
+
+// GetMetrics returns runtime metrics as a JSON string
+// The JSON has an "operations" section with per-operation call counts
+// and latency histograms, and a "platform" section with
+// platform-specific counters (WebSocket reconnects, queue depth, dropped
+// events, and similar)
+func (p *Platform) GetMetrics() (string, error) {
+	if p.handle == nil {
+		return "", ErrInvalidHandle
+	}
+
+	cstr := C.communicator_platform_get_metrics(p.handle)
+	if cstr == nil {
+		return "", getLastError()
+	}
+	defer freeString(cstr)
+
+	return C.GoString(cstr), nil
+}
+
+// ResetMetrics resets all runtime metrics to zero, starting a fresh
+// measurement window
+func (p *Platform) ResetMetrics() error {
+	if p.handle == nil {
+		return ErrInvalidHandle
+	}
+
+	code := C.communicator_platform_reset_metrics(p.handle)
+	if code != C.COMMUNICATOR_SUCCESS {
+		return getLastError()
+	}
+
+	return nil
+}
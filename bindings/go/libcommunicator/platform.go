@@ -8,12 +8,17 @@ import "C"
 import (
 	"encoding/json"
 	"runtime"
+	"runtime/cgo"
 	"unsafe"
 )
 
 // Platform represents a chat platform (Mattermost, Slack, etc.)
 type Platform struct {
 	handle C.CommunicatorPlatform
+	// Handles pinning the Go callbacks registered with the library;
+	// released when the callback is cleared or the platform destroyed
+	eventCallback       cgo.Handle
+	sendFailureCallback cgo.Handle
 }
 
 // NewMattermostPlatform creates a new Mattermost platform instance
@@ -430,6 +435,43 @@ func (p *Platform) PollEvent() (*Event, error) {
 	return &event, nil
 }
 
+// PollEventsBatch drains up to maxEvents queued events in a single call
+// This amortizes the FFI crossing cost across the whole batch and is much
+// cheaper than calling PollEvent in a loop during event bursts
+// Returns an empty slice if no events are available
+func (p *Platform) PollEventsBatch(maxEvents int) ([]*Event, error) {
+	if p.handle == nil {
+		return nil, ErrInvalidHandle
+	}
+
+	var cEvents **C.char
+	var cCount C.size_t
+
+	code := C.communicator_platform_poll_events_batch(p.handle, C.size_t(maxEvents), &cEvents, &cCount)
+	if code != C.COMMUNICATOR_SUCCESS {
+		return nil, getLastError()
+	}
+
+	if cEvents == nil || cCount == 0 {
+		return nil, nil
+	}
+	defer C.communicator_free_event_batch(cEvents, cCount)
+
+	count := int(cCount)
+	cSlice := unsafe.Slice(cEvents, count)
+
+	events := make([]*Event, 0, count)
+	for _, cstr := range cSlice {
+		var event Event
+		if err := json.Unmarshal([]byte(C.GoString(cstr)), &event); err != nil {
+			return nil, err
+		}
+		events = append(events, &event)
+	}
+
+	return events, nil
+}
+
 // SendReply sends a reply to a message (threaded conversation)
 func (p *Platform) SendReply(channelID, text, rootID string) (*Message, error) {
 	if p.handle == nil {
@@ -1511,12 +1553,140 @@ func (p *Platform) DeleteChannel(channelID string) error {
 	return nil
 }
 
+// Bootstrap fetches the full startup data set in one call
+// The current user, teams, channels, unread counts, and optionally
+// per-channel members are hydrated concurrently, replacing the dozens of
+// sequential calls clients otherwise make at startup
+func (p *Platform) Bootstrap(includeMembers bool) (*BootstrapSnapshot, error) {
+	if p.handle == nil {
+		return nil, ErrInvalidHandle
+	}
+
+	options := struct {
+		IncludeMembers bool `json:"include_members"`
+	}{IncludeMembers: includeMembers}
+	jsonBytes, err := json.Marshal(options)
+	if err != nil {
+		return nil, err
+	}
+
+	cs, free := cStringFree(string(jsonBytes))
+	defer free()
+
+	cstr := C.communicator_platform_bootstrap(p.handle, cs)
+	if cstr == nil {
+		return nil, getLastError()
+	}
+	defer freeString(cstr)
+
+	var snapshot BootstrapSnapshot
+	if err := json.Unmarshal([]byte(C.GoString(cstr)), &snapshot); err != nil {
+		return nil, err
+	}
+
+	return &snapshot, nil
+}
+
+// SyncChannelsSince returns only the channels that changed since a
+// timestamp (milliseconds since epoch); changes strictly after that
+// point are returned. Pass a negative sinceMs to continue from the
+// previous sync (the first such call returns everything)
+func (p *Platform) SyncChannelsSince(sinceMs int64) (*ChannelSyncDelta, error) {
+	if p.handle == nil {
+		return nil, ErrInvalidHandle
+	}
+
+	cstr := C.communicator_platform_sync_channels_since(p.handle, C.int64_t(sinceMs))
+	if cstr == nil {
+		return nil, getLastError()
+	}
+	defer freeString(cstr)
+
+	var delta ChannelSyncDelta
+	if err := json.Unmarshal([]byte(C.GoString(cstr)), &delta); err != nil {
+		return nil, err
+	}
+
+	return &delta, nil
+}
+
+// GetChannelMembersBulk returns members for many channels in one
+// aggregated call. The channels are fetched concurrently with bounded
+// parallelism; each channel gets its own result, so one failing channel
+// does not abort the batch
+func (p *Platform) GetChannelMembersBulk(channelIDs []string) (map[string]BulkMembersResult, error) {
+	if p.handle == nil {
+		return nil, ErrInvalidHandle
+	}
+
+	jsonBytes, err := json.Marshal(channelIDs)
+	if err != nil {
+		return nil, err
+	}
+
+	cs, free := cStringFree(string(jsonBytes))
+	defer free()
+
+	cstr := C.communicator_platform_get_channel_members_bulk(p.handle, cs)
+	if cstr == nil {
+		return nil, getLastError()
+	}
+	defer freeString(cstr)
+
+	var results map[string]BulkMembersResult
+	if err := json.Unmarshal([]byte(C.GoString(cstr)), &results); err != nil {
+		return nil, err
+	}
+
+	return results, nil
+}
+
+// SetResponseFields configures which fields the JSON-returning APIs
+// serialize for this platform. entity is "message" (GetMessages and its
+// before/after variants) or "user" (GetChannelMembers); fields holds the
+// top-level field names to keep, and an empty or nil slice clears the
+// mask and restores full serialization
+func (p *Platform) SetResponseFields(entity string, fields []string) error {
+	if p.handle == nil {
+		return ErrInvalidHandle
+	}
+
+	if fields == nil {
+		fields = []string{}
+	}
+	jsonBytes, err := json.Marshal(fields)
+	if err != nil {
+		return err
+	}
+
+	csEntity, freeEntity := cStringFree(entity)
+	defer freeEntity()
+
+	csFields, freeFields := cStringFree(string(jsonBytes))
+	defer freeFields()
+
+	code := C.communicator_platform_set_response_fields(p.handle, csEntity, csFields)
+	if code != C.COMMUNICATOR_SUCCESS {
+		return getLastError()
+	}
+
+	return nil
+}
+
 // Destroy destroys the platform and frees its resources
 func (p *Platform) Destroy() {
 	if p.handle != nil {
 		C.communicator_platform_destroy(p.handle)
 		p.handle = nil
 	}
+	if p.eventCallback != 0 {
+		p.eventCallback.Delete()
+		p.eventCallback = 0
+	}
+	if p.sendFailureCallback != 0 {
+		p.sendFailureCallback.Delete()
+		p.sendFailureCallback = 0
+	}
 }
 
 var (
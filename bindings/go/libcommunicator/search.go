@@ -205,3 +205,29 @@ func (p *Platform) SearchPostsAdvanced(options *PostSearchOptions) (string, erro
 
 	return C.GoString(result), nil
 }
+
+// SearchMessagesLocal searches the local message index, falling back to
+// server search when the index is not configured (see the
+// message_index.path context config key)
+// Local hits cost no network round trip and are not rate limited
+func (p *Platform) SearchMessagesLocal(query string, limit uint32) ([]Message, error) {
+	if p.handle == nil {
+		return nil, ErrInvalidHandle
+	}
+
+	cQuery := C.CString(query)
+	defer C.free(unsafe.Pointer(cQuery))
+
+	result := C.communicator_platform_search_messages_local(p.handle, cQuery, C.uint32_t(limit))
+	if result == nil {
+		return nil, getLastError()
+	}
+	defer C.communicator_free_string(result)
+
+	var messages []Message
+	if err := json.Unmarshal([]byte(C.GoString(result)), &messages); err != nil {
+		return nil, err
+	}
+
+	return messages, nil
+}
@@ -0,0 +1,90 @@
+package libcommunicator
+
+/*
+#include <communicator.h>
+#include <stdlib.h>
+
+extern void goUploadProgressBridge(uint64_t bytes_sent, uint64_t total_bytes, void* user_data);
+extern int32_t goDownloadChunkBridge(uint8_t* data, size_t size, void* user_data);
+
+static char* go_upload_file_streaming(CommunicatorPlatform platform, const char* channel_id, const char* file_path, uintptr_t user_data) {
+	return communicator_platform_upload_file_streaming(
+		platform, channel_id, file_path, (CommunicatorUploadProgressCallback)goUploadProgressBridge, (void*)user_data);
+}
+
+static CommunicatorErrorCode go_download_file_streaming(CommunicatorPlatform platform, const char* file_id, uintptr_t user_data) {
+	return communicator_platform_download_file_streaming(
+		platform, file_id, (CommunicatorDownloadChunkCallback)goDownloadChunkBridge, (void*)user_data);
+}
+*/
+import "C"
+import (
+	"runtime/cgo"
+)
+
+// UploadProgressCallback receives progress updates during a streaming
+// upload. totalBytes is 0 when the file size is unknown
+type UploadProgressCallback func(bytesSent, totalBytes uint64)
+
+// DownloadChunkCallback receives one chunk of a streaming download
+// Return false to cancel the download; the chunk slice is only valid for
+// the duration of the call if retained, copy it
+type DownloadChunkCallback func(chunk []byte) bool
+
+// UploadFileStreaming uploads a file, streaming it from disk in bounded
+// chunks so memory usage stays constant regardless of file size
+// progress may be nil. Returns the file ID on success
+func (p *Platform) UploadFileStreaming(channelID, filePath string, progress UploadProgressCallback) (string, error) {
+	if p.handle == nil {
+		return "", ErrInvalidHandle
+	}
+
+	csChannelID, freeChannelID := cStringFree(channelID)
+	defer freeChannelID()
+
+	csFilePath, freeFilePath := cStringFree(filePath)
+	defer freeFilePath()
+
+	var result *C.char
+	if progress == nil {
+		result = C.communicator_platform_upload_file_streaming(p.handle, csChannelID, csFilePath, nil, nil)
+	} else {
+		// The call blocks until the upload finishes, so the handle only
+		// needs to live for its duration
+		handle := cgo.NewHandle(progress)
+		defer handle.Delete()
+		result = C.go_upload_file_streaming(p.handle, csChannelID, csFilePath, C.uintptr_t(handle))
+	}
+	if result == nil {
+		return "", getLastError()
+	}
+	defer freeString(result)
+
+	return C.GoString(result), nil
+}
+
+// DownloadFileStreaming downloads a file, delivering the body in chunks
+// as they arrive from the network, so memory usage stays constant and
+// network and disk I/O can overlap. Blocks until the download completes,
+// is cancelled by the callback returning false, or fails
+func (p *Platform) DownloadFileStreaming(fileID string, chunk DownloadChunkCallback) error {
+	if p.handle == nil {
+		return ErrInvalidHandle
+	}
+	if chunk == nil {
+		return newError(ErrorInvalidArg, "chunk callback must not be nil")
+	}
+
+	csFileID, freeFileID := cStringFree(fileID)
+	defer freeFileID()
+
+	handle := cgo.NewHandle(chunk)
+	defer handle.Delete()
+
+	code := C.go_download_file_streaming(p.handle, csFileID, C.uintptr_t(handle))
+	if code != C.COMMUNICATOR_SUCCESS {
+		return getLastError()
+	}
+
+	return nil
+}
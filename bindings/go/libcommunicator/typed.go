@@ -0,0 +1,167 @@
+package libcommunicator
+
+/*
+#include <communicator.h>
+#include <stdlib.h>
+*/
+import "C"
+import (
+	"time"
+	"unsafe"
+)
+
+// Typed struct API: hot read paths can fetch fixed-field C structs
+// populated directly from the native types, skipping JSON serialization
+// and re-parsing on both sides of the FFI boundary. Variable or
+// platform-specific data (attachments, metadata) is only available
+// through the JSON-based methods.
+
+// GetMessagesTyped returns recent messages from a channel via the typed
+// struct API. Attachment details and metadata are not populated; use
+// GetMessages when they are needed
+func (p *Platform) GetMessagesTyped(channelID string, limit int) ([]Message, error) {
+	if p.handle == nil {
+		return nil, ErrInvalidHandle
+	}
+
+	cs, free := cStringFree(channelID)
+	defer free()
+
+	var list C.CommunicatorMessageList
+	code := C.communicator_platform_get_messages_typed(p.handle, cs, C.size_t(limit), &list)
+	if code != C.COMMUNICATOR_SUCCESS {
+		return nil, getLastError()
+	}
+	defer C.communicator_free_message_list(&list)
+
+	if list.items == nil || list.count == 0 {
+		return nil, nil
+	}
+
+	items := unsafe.Slice(list.items, int(list.count))
+	messages := make([]Message, 0, len(items))
+	for i := range items {
+		messages = append(messages, messageFromTyped(&items[i]))
+	}
+
+	return messages, nil
+}
+
+// GetChannelsTyped returns all channels for the current user via the
+// typed struct API
+func (p *Platform) GetChannelsTyped() ([]Channel, error) {
+	if p.handle == nil {
+		return nil, ErrInvalidHandle
+	}
+
+	var list C.CommunicatorChannelList
+	code := C.communicator_platform_get_channels_typed(p.handle, &list)
+	if code != C.COMMUNICATOR_SUCCESS {
+		return nil, getLastError()
+	}
+	defer C.communicator_free_channel_list(&list)
+
+	if list.items == nil || list.count == 0 {
+		return nil, nil
+	}
+
+	items := unsafe.Slice(list.items, int(list.count))
+	channels := make([]Channel, 0, len(items))
+	for i := range items {
+		channels = append(channels, channelFromTyped(&items[i]))
+	}
+
+	return channels, nil
+}
+
+// GetChannelMembersTyped returns members of a channel via the typed
+// struct API
+func (p *Platform) GetChannelMembersTyped(channelID string) ([]User, error) {
+	if p.handle == nil {
+		return nil, ErrInvalidHandle
+	}
+
+	cs, free := cStringFree(channelID)
+	defer free()
+
+	var list C.CommunicatorUserList
+	code := C.communicator_platform_get_channel_members_typed(p.handle, cs, &list)
+	if code != C.COMMUNICATOR_SUCCESS {
+		return nil, getLastError()
+	}
+	defer C.communicator_free_user_list(&list)
+
+	if list.items == nil || list.count == 0 {
+		return nil, nil
+	}
+
+	items := unsafe.Slice(list.items, int(list.count))
+	users := make([]User, 0, len(items))
+	for i := range items {
+		users = append(users, userFromTyped(&items[i]))
+	}
+
+	return users, nil
+}
+
+func messageFromTyped(m *C.CommunicatorMessage) Message {
+	message := Message{
+		ID:        C.GoString(m.id),
+		ChannelID: C.GoString(m.channel_id),
+		SenderID:  C.GoString(m.sender_id),
+		Text:      C.GoString(m.text),
+		CreatedAt: time.UnixMilli(int64(m.created_at)).UTC(),
+	}
+	if m.edited_at != 0 {
+		edited := time.UnixMilli(int64(m.edited_at)).UTC()
+		message.EditedAt = &edited
+	}
+	return message
+}
+
+func channelFromTyped(c *C.CommunicatorChannel) Channel {
+	return Channel{
+		ID:          C.GoString(c.id),
+		Name:        C.GoString(c.name),
+		DisplayName: C.GoString(c.display_name),
+		Type:        channelTypeFromTyped(c.channel_type),
+	}
+}
+
+func channelTypeFromTyped(channelType C.CommunicatorChannelType) ChannelType {
+	switch channelType {
+	case C.COMMUNICATOR_CHANNEL_PRIVATE:
+		return ChannelTypePrivate
+	case C.COMMUNICATOR_CHANNEL_DIRECT_MESSAGE:
+		return ChannelTypeDirectMessage
+	case C.COMMUNICATOR_CHANNEL_GROUP_MESSAGE:
+		return ChannelTypeGroupMessage
+	default:
+		return ChannelTypePublic
+	}
+}
+
+func userFromTyped(u *C.CommunicatorUser) User {
+	return User{
+		ID:       C.GoString(u.id),
+		Username: C.GoString(u.username),
+		Name:     C.GoString(u.display_name),
+		Email:    C.GoString(u.email),
+		Status:   userStatusFromTyped(u.status),
+	}
+}
+
+func userStatusFromTyped(status C.CommunicatorUserStatus) string {
+	switch status {
+	case C.COMMUNICATOR_USER_STATUS_ONLINE:
+		return "online"
+	case C.COMMUNICATOR_USER_STATUS_AWAY:
+		return "away"
+	case C.COMMUNICATOR_USER_STATUS_DND:
+		return "dnd"
+	case C.COMMUNICATOR_USER_STATUS_OFFLINE:
+		return "offline"
+	default:
+		return "unknown"
+	}
+}
@@ -154,6 +154,38 @@ const (
 	EventReactionRemoved       = "reaction_removed"
 )
 
+// BootstrapSnapshot holds the full startup data set from Bootstrap
+type BootstrapSnapshot struct {
+	CurrentUser User            `json:"current_user"`
+	Teams       []Team          `json:"teams"`
+	Channels    []Channel       `json:"channels"`
+	Unreads     []ChannelUnread `json:"unreads"`
+	// Members maps channel ID to member list when members were requested
+	// Channels whose member fetch failed are absent
+	Members map[string][]User `json:"members"`
+}
+
+// ChannelSyncDelta holds the channel changes from SyncChannelsSince
+type ChannelSyncDelta struct {
+	Created    []Channel `json:"created"`
+	Updated    []Channel `json:"updated"`
+	DeletedIDs []string  `json:"deleted_ids"`
+	// SyncedAt is the new high-water timestamp to pass to the next sync
+	SyncedAt int64 `json:"synced_at"`
+}
+
+// BulkMembersResult holds one channel's outcome from GetChannelMembersBulk
+type BulkMembersResult struct {
+	Members []User         `json:"members,omitempty"`
+	Error   *BulkCallError `json:"error,omitempty"`
+}
+
+// BulkCallError describes a per-channel failure in a bulk call
+type BulkCallError struct {
+	Code    ErrorCode `json:"code"`
+	Message string    `json:"message"`
+}
+
 // PlatformConfig holds configuration for connecting to a platform
 type PlatformConfig struct {
 	Server      string            `json:"server"`
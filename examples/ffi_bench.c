@@ -0,0 +1,106 @@
+/**
+ * FFI round-trip benchmark harness
+ *
+ * Measures the end-to-end cost of crossing the FFI boundary for the hot
+ * paths: event polling and string-returning calls. The platform is created
+ * against a mock URL and never connects, so the numbers isolate the
+ * library-side overhead (argument validation, runtime block_on dispatch,
+ * JSON serialization, string export) from network latency.
+ *
+ * The companion Rust benchmarks in benches/hot_paths.rs measure the same
+ * paths without the FFI boundary; the difference between the two is the
+ * per-call FFI overhead.
+ *
+ * Build with `make ffi_bench` (requires `cargo build --release` first).
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "../include/communicator.h"
+
+/* Iterations per measured call; bump for more stable numbers */
+#define ITERATIONS 100000
+
+static double now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec * 1e9 + (double)ts.tv_nsec;
+}
+
+static void report(const char* name, double start_ns, double end_ns, long iterations) {
+    double per_call = (end_ns - start_ns) / (double)iterations;
+    printf("%-40s %10.1f ns/call  (%.2f ms total, %ld calls)\n",
+           name, per_call, (end_ns - start_ns) / 1e6, iterations);
+}
+
+int main(void) {
+    if (communicator_init() != COMMUNICATOR_SUCCESS) {
+        fprintf(stderr, "Failed to initialize library\n");
+        return 1;
+    }
+
+    CommunicatorPlatform platform =
+        communicator_mattermost_create("https://mock.invalid");
+    if (platform == NULL) {
+        fprintf(stderr, "Failed to create platform\n");
+        communicator_cleanup();
+        return 1;
+    }
+
+    printf("libcommunicator FFI round-trip benchmark (%s)\n\n",
+           communicator_version());
+
+    double start, end;
+    long i;
+
+    /* Pure FFI boundary cost: no runtime dispatch, no allocation */
+    start = now_ns();
+    for (i = 0; i < ITERATIONS; i++) {
+        (void)communicator_version_major();
+    }
+    end = now_ns();
+    report("version_major (baseline)", start, end, ITERATIONS);
+
+    /* FFI + runtime block_on dispatch; no events are queued, so this is
+     * the fixed cost every poll pays before any event work happens */
+    start = now_ns();
+    for (i = 0; i < ITERATIONS; i++) {
+        char* event = communicator_platform_poll_event(platform);
+        if (event != NULL) {
+            communicator_free_string(event);
+        }
+    }
+    end = now_ns();
+    report("poll_event (empty queue)", start, end, ITERATIONS);
+
+    /* FFI + runtime dispatch + JSON serialization + string export */
+    start = now_ns();
+    for (i = 0; i < ITERATIONS; i++) {
+        char* stats = communicator_platform_get_cache_stats(platform);
+        if (stats != NULL) {
+            communicator_free_string(stats);
+        }
+    }
+    end = now_ns();
+    report("get_cache_stats (string return)", start, end, ITERATIONS);
+
+    /* Same string-returning call with arena-owned strings: one bulk free
+     * instead of a malloc/free pair per call */
+    CommunicatorArena arena = communicator_arena_create();
+    if (arena != NULL) {
+        communicator_arena_set_current(arena);
+        start = now_ns();
+        for (i = 0; i < ITERATIONS; i++) {
+            (void)communicator_platform_get_cache_stats(platform);
+        }
+        end = now_ns();
+        communicator_arena_set_current(NULL);
+        communicator_arena_destroy(arena);
+        report("get_cache_stats (arena strings)", start, end, ITERATIONS);
+    }
+
+    communicator_platform_destroy(platform);
+    communicator_cleanup();
+    return 0;
+}
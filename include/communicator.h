@@ -1,6 +1,7 @@
 #ifndef COMMUNICATOR_H
 #define COMMUNICATOR_H
 
+#include <stddef.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -59,6 +60,60 @@ const char* communicator_error_code_string(CommunicatorErrorCode code);
  */
 void communicator_clear_error(void);
 
+// ============================================================================
+// Arena Allocation
+// ============================================================================
+
+/**
+ * Opaque handle to a string arena
+ */
+typedef void* CommunicatorArena;
+
+/**
+ * Create a string arena
+ *
+ * While installed as current on a thread, every string returned by FFI calls
+ * on that thread is owned by the arena instead of being individually
+ * allocated; a single reset or destroy releases the whole batch. Intended
+ * for batch workloads where per-string communicator_free_string() calls
+ * dominate allocator time.
+ *
+ * @return An opaque handle to the arena, or NULL on error
+ */
+CommunicatorArena communicator_arena_create(void);
+
+/**
+ * Install an arena as the current one for the calling thread
+ *
+ * While an arena is current, strings returned on this thread must NOT be
+ * passed to communicator_free_string() - they are freed by arena reset or
+ * destroy. The arena must stay alive while installed. Pass NULL to clear
+ * and return to per-string ownership.
+ *
+ * @param arena The arena handle, or NULL to clear
+ * @return Error code indicating success or failure
+ */
+CommunicatorErrorCode communicator_arena_set_current(CommunicatorArena arena);
+
+/**
+ * Free every string owned by an arena, keeping the arena reusable
+ *
+ * All strings returned while the arena was current become invalid.
+ *
+ * @param arena The arena handle
+ */
+void communicator_arena_reset(CommunicatorArena arena);
+
+/**
+ * Destroy an arena and free every string it owns
+ *
+ * If the arena is current on the calling thread it is cleared first; other
+ * threads must stop using the arena before it is destroyed.
+ *
+ * @param arena The arena handle
+ */
+void communicator_arena_destroy(CommunicatorArena arena);
+
 // ============================================================================
 // Library Initialization
 // ============================================================================
@@ -67,6 +122,11 @@ void communicator_clear_error(void);
  * Initialize the library
  * This should be called once before using any other library functions
  *
+ * Concurrency: after initialization, blocking API calls made from different
+ * threads run concurrently on a shared internal runtime - a slow call on one
+ * thread does not serialize calls on other threads. Calls targeting the same
+ * handle may still be ordered by that handle's internal state.
+ *
  * @return Error code indicating success or failure
  */
 CommunicatorErrorCode communicator_init(void);
@@ -148,6 +208,12 @@ int communicator_context_is_initialized(CommunicatorContext handle);
 /**
  * Set a configuration value on a context
  *
+ * Recognized keys (applied by communicator_context_initialize):
+ *   "runtime.worker_threads": thread count for the shared async runtime.
+ *     Only effective if set before the runtime is created, i.e. initialize
+ *     the context before calling communicator_init. Useful for
+ *     multi-tenant processes hosting many platform handles.
+ *
  * @param handle The context handle
  * @param key The configuration key
  * @param value The configuration value
@@ -359,6 +425,51 @@ char* communicator_platform_send_message(
  */
 char* communicator_platform_get_channels(CommunicatorPlatform platform);
 
+/**
+ * Get only the channels that changed since a timestamp
+ *
+ * Intended for reconnect recovery: instead of re-fetching the full channel
+ * list, consumers apply the usually tiny delta. The library tracks the
+ * high-water timestamp internally, so a negative since_ms continues from
+ * the previous sync (the first such call returns everything).
+ *
+ * @param platform The platform handle
+ * @param since_ms Timestamp in milliseconds since epoch; changes strictly
+ *                 after this point are returned, or negative to continue
+ *                 from the previous sync
+ * @return A JSON object string with "created" and "updated" arrays of
+ *         Channel objects, a "deleted_ids" array of channel IDs, and the
+ *         new high-water timestamp in "synced_at"
+ *         Must be freed with communicator_free_string()
+ *         Returns NULL on error
+ */
+char* communicator_platform_sync_channels_since(
+    CommunicatorPlatform platform,
+    int64_t since_ms
+);
+
+/**
+ * Fetch the full startup data set in one call
+ *
+ * Hydrates the current user, teams, channels, unread counts, and
+ * optionally per-channel members concurrently, replacing the dozens of
+ * sequential calls clients otherwise make at startup.
+ *
+ * @param platform The platform handle
+ * @param options_json JSON options:
+ *                     {
+ *                       "include_members": true   // optional, default true
+ *                     }
+ * @return A JSON object with "current_user", "teams", "channels",
+ *         "unreads", and a "members" map of channel ID to member arrays
+ *         Must be freed with communicator_free_string()
+ *         Returns NULL on error
+ */
+char* communicator_platform_bootstrap(
+    CommunicatorPlatform platform,
+    const char* options_json
+);
+
 /**
  * Get a specific channel by ID
  *
@@ -403,6 +514,47 @@ char* communicator_platform_get_channel_members(
     const char* channel_id
 );
 
+/**
+ * Configure which fields string-returning APIs serialize
+ *
+ * Responses from communicator_platform_get_messages (and its before/after
+ * variants) and communicator_platform_get_channel_members serialize every
+ * field of Message/User by default. A field mask restricts serialization
+ * to the listed top-level fields, shrinking both the JSON generated by
+ * the library and the JSON the consumer has to parse on hot paths.
+ *
+ * @param platform The platform handle
+ * @param entity The response type the mask applies to: "message" or "user"
+ * @param fields_json JSON array of field names to keep, e.g.
+ *                    ["id","text","created_at"]; an empty array clears the
+ *                    mask and restores full serialization
+ * @return Error code indicating success or failure
+ */
+CommunicatorErrorCode communicator_platform_set_response_fields(
+    CommunicatorPlatform platform,
+    const char* entity,
+    const char* fields_json
+);
+
+/**
+ * Get members for many channels in one aggregated call
+ *
+ * The channels are fetched concurrently with bounded parallelism instead of
+ * one serialized round trip per channel. Each channel gets its own result,
+ * so one failing channel does not abort the batch.
+ *
+ * @param platform The platform handle
+ * @param channel_ids_json JSON array of channel IDs, e.g. ["ch1","ch2"]
+ * @return A JSON string mapping each channel ID to {"members": [...]} on
+ *         success or {"error": {"code": ..., "message": ...}} on failure
+ *         Must be freed with communicator_free_string()
+ *         Returns NULL on error
+ */
+char* communicator_platform_get_channel_members_bulk(
+    CommunicatorPlatform platform,
+    const char* channel_ids_json
+);
+
 /**
  * Get a specific user by ID
  *
@@ -546,6 +698,515 @@ CommunicatorErrorCode communicator_platform_unsubscribe_events(CommunicatorPlatf
  */
 char* communicator_platform_poll_event(CommunicatorPlatform platform);
 
+/**
+ * Poll for multiple events in a single call
+ *
+ * Drains up to max_events queued events into one array, amortizing the FFI
+ * crossing and per-event allocation cost across the whole batch. Each array
+ * entry is a JSON string in the same format as communicator_platform_poll_event().
+ *
+ * @param platform The platform handle
+ * @param max_events Maximum number of events to drain in this call
+ * @param out_events Receives a pointer to an array of JSON event strings
+ *                   Set to NULL if no events are available
+ *                   Must be freed with communicator_free_event_batch()
+ * @param out_count Receives the number of events in the array
+ * @return Error code indicating success or failure
+ */
+CommunicatorErrorCode communicator_platform_poll_events_batch(
+    CommunicatorPlatform platform,
+    size_t max_events,
+    char*** out_events,
+    size_t* out_count
+);
+
+/**
+ * Free an event array returned by communicator_platform_poll_events_batch()
+ *
+ * Frees each event string and the array itself.
+ *
+ * @param events The event array to free
+ * @param count The event count returned by the batch poll
+ */
+void communicator_free_event_batch(char** events, size_t count);
+
+/**
+ * Event callback function type for push-mode delivery
+ *
+ * @param event_json JSON string describing the event (do NOT free this
+ *                   pointer; it is only valid for the duration of the call)
+ * @param user_data Opaque user data passed to the callback
+ */
+typedef void (*CommunicatorEventCallback)(
+    const char* event_json,
+    void* user_data
+);
+
+/**
+ * Register a callback for push-mode event delivery
+ *
+ * When a callback is registered, events are delivered directly from the
+ * library's internal runtime threads instead of being queued for polling.
+ * The callback must be cheap and must not block. Pass NULL as the callback
+ * to clear it and return to poll mode.
+ *
+ * @param platform The platform handle
+ * @param callback The callback function, or NULL to clear
+ * @param user_data Opaque pointer passed back to the callback; must remain
+ *                  valid until the callback is cleared or the platform is
+ *                  destroyed
+ * @return Error code indicating success or failure
+ */
+CommunicatorErrorCode communicator_platform_set_event_callback(
+    CommunicatorPlatform platform,
+    CommunicatorEventCallback callback,
+    void* user_data
+);
+
+/**
+ * Set a subscription filter for incoming events
+ *
+ * Filtered events are dropped before full deserialization and never occupy
+ * the event queue, which keeps heavy streams (typing, status changes) cheap
+ * when they are not consumed. Events without a channel always pass the
+ * channel filter.
+ *
+ * @param platform The platform handle
+ * @param types_json JSON array of platform-native event type names to accept
+ *                   (e.g. ["posted","post_edited"]), or NULL for all types
+ * @param channel_ids_json JSON array of channel IDs to accept, or NULL for
+ *                         all channels. Pass NULL for both arguments to
+ *                         clear the filter
+ * @return Error code indicating success or failure
+ */
+CommunicatorErrorCode communicator_platform_set_event_filter(
+    CommunicatorPlatform platform,
+    const char* types_json,
+    const char* channel_ids_json
+);
+
+/**
+ * Policy applied when the event queue is full
+ */
+typedef enum {
+    /** Drop the incoming event (default) */
+    COMMUNICATOR_OVERFLOW_DROP_NEWEST = 0,
+    /** Evict the oldest queued event to make room for the incoming one */
+    COMMUNICATOR_OVERFLOW_DROP_OLDEST = 1,
+    /** Block the reader task up to a timeout, then drop the incoming event */
+    COMMUNICATOR_OVERFLOW_BLOCK_WITH_TIMEOUT = 2,
+} CommunicatorOverflowPolicy;
+
+/**
+ * Set the policy applied when the event queue overflows
+ *
+ * Dropped events are counted per event type in the metrics returned by
+ * communicator_platform_get_metrics, alongside the current queue depth,
+ * so consumers can shed load deliberately instead of losing events
+ * silently.
+ *
+ * @param platform The platform handle
+ * @param policy One of the CommunicatorOverflowPolicy values
+ * @param timeout_ms Maximum blocking time in milliseconds; only used with
+ *                   COMMUNICATOR_OVERFLOW_BLOCK_WITH_TIMEOUT
+ * @return Error code indicating success or failure
+ */
+CommunicatorErrorCode communicator_platform_set_queue_overflow_policy(
+    CommunicatorPlatform platform,
+    int policy,
+    uint64_t timeout_ms
+);
+
+// ============================================================================
+// Async Send Operations
+// ============================================================================
+
+/**
+ * Completion callback function type for async send operations
+ *
+ * @param request_id The id returned by the async send call
+ * @param message_json JSON string of the created message on success, NULL on
+ *                     failure (do NOT free this pointer; it is only valid for
+ *                     the duration of the call)
+ * @param error_code COMMUNICATOR_SUCCESS or the error that occurred
+ * @param user_data Opaque user data passed to the async send call
+ */
+typedef void (*CommunicatorSendCallback)(
+    uint64_t request_id,
+    const char* message_json,
+    CommunicatorErrorCode error_code,
+    void* user_data
+);
+
+/**
+ * Set the maximum number of concurrent async send requests
+ *
+ * Applies to requests started after this call. Defaults to 16.
+ *
+ * @param limit The concurrency limit (must be greater than zero)
+ * @return Error code indicating success or failure
+ */
+CommunicatorErrorCode communicator_set_async_send_limit(size_t limit);
+
+/**
+ * Send a message without blocking the calling thread
+ *
+ * The request executes concurrently on the library's internal runtime,
+ * bounded by the async send limit. The callback is invoked exactly once on a
+ * runtime thread with the result. The platform handle and user_data must
+ * remain valid until the callback fires.
+ *
+ * @param platform The platform handle
+ * @param channel_id The channel ID to send the message to
+ * @param text The message text
+ * @param callback The completion callback
+ * @param user_data Opaque pointer passed back to the callback
+ * @return The request id (> 0), or 0 on immediate failure
+ */
+uint64_t communicator_platform_send_message_async(
+    CommunicatorPlatform platform,
+    const char* channel_id,
+    const char* text,
+    CommunicatorSendCallback callback,
+    void* user_data
+);
+
+/**
+ * Send a threaded reply without blocking the calling thread
+ *
+ * Async variant of communicator_platform_send_reply(); see
+ * communicator_platform_send_message_async() for callback semantics.
+ *
+ * @param platform The platform handle
+ * @param channel_id The channel ID to send the reply to
+ * @param text The reply text
+ * @param root_id The ID of the root message of the thread
+ * @param callback The completion callback
+ * @param user_data Opaque pointer passed back to the callback
+ * @return The request id (> 0), or 0 on immediate failure
+ */
+uint64_t communicator_platform_send_reply_async(
+    CommunicatorPlatform platform,
+    const char* channel_id,
+    const char* text,
+    const char* root_id,
+    CommunicatorSendCallback callback,
+    void* user_data
+);
+
+/**
+ * Callback function type for terminal outbound queue failures
+ *
+ * Invoked on a library runtime thread after an enqueued message has
+ * exhausted its retries (or failed non-transiently). The string pointers
+ * are only valid for the duration of the call.
+ *
+ * @param channel_id The channel the message was destined for
+ * @param text The message text that could not be delivered
+ * @param error_code The error that ended delivery
+ * @param user_data Opaque user data from the registration call
+ */
+typedef void (*CommunicatorSendFailureCallback)(
+    const char* channel_id,
+    const char* text,
+    CommunicatorErrorCode error_code,
+    void* user_data
+);
+
+/**
+ * Enqueue a message for background delivery
+ *
+ * Returns as soon as the message is queued. A background task delivers it
+ * with per-channel ordering, retrying transient failures (network errors,
+ * rate limiting, timeouts) with exponential backoff; terminal failures
+ * are reported through the registered failure callback and the message is
+ * dropped. Fails with an invalid-state error when the channel's queue is
+ * full.
+ *
+ * @param platform The platform handle
+ * @param channel_id The channel ID to send the message to
+ * @param text The message text
+ * @return Error code indicating success or failure
+ */
+CommunicatorErrorCode communicator_platform_enqueue_message(
+    CommunicatorPlatform platform,
+    const char* channel_id,
+    const char* text
+);
+
+/**
+ * Register a callback for terminal outbound queue failures
+ *
+ * Pass NULL as the callback to clear it. user_data must remain valid
+ * until the callback is cleared or the platform is destroyed.
+ *
+ * @param platform The platform handle
+ * @param callback The failure callback, or NULL to clear
+ * @param user_data Opaque pointer passed back to the callback
+ * @return Error code indicating success or failure
+ */
+CommunicatorErrorCode communicator_platform_set_callback_send_failure(
+    CommunicatorPlatform platform,
+    CommunicatorSendFailureCallback callback,
+    void* user_data
+);
+
+// ============================================================================
+// Cache Snapshots
+// ============================================================================
+
+/**
+ * Save the platform's cache contents to a snapshot file
+ *
+ * Intended to be called during shutdown; the next process start can load the
+ * snapshot and skip the cold-start burst of API calls. The file is written
+ * atomically (temporary file plus rename).
+ *
+ * @param platform The platform handle
+ * @param path Where to write the snapshot file
+ * @return Error code indicating success or failure
+ */
+CommunicatorErrorCode communicator_platform_save_cache_snapshot(
+    CommunicatorPlatform platform,
+    const char* path
+);
+
+/**
+ * Load the platform's cache contents from a snapshot file
+ *
+ * Call after connecting for a warm start. Loaded entries keep their
+ * remaining TTL (capped at the configured TTL) and are revalidated lazily
+ * against the server as they expire.
+ *
+ * @param platform The platform handle
+ * @param path The snapshot file to load
+ * @return Error code indicating success or failure
+ */
+CommunicatorErrorCode communicator_platform_load_cache_snapshot(
+    CommunicatorPlatform platform,
+    const char* path
+);
+
+/**
+ * Get cache statistics as a JSON string
+ *
+ * The returned JSON maps cache names to hit, miss and eviction counters
+ * plus the current and maximum entry counts, e.g.:
+ *   {"users":{"hits":42,"misses":7,"evictions":0,"entries":35,"max_entries":10000},...}
+ * Which caches exist varies by platform.
+ *
+ * @param platform The platform handle
+ * @return JSON string (must be freed with communicator_free_string), or NULL on error
+ */
+char* communicator_platform_get_cache_stats(CommunicatorPlatform platform);
+
+/**
+ * Get runtime metrics as a JSON string
+ *
+ * The returned JSON has two sections:
+ *   "operations": per-FFI-operation call counts and latency histograms
+ *     with power-of-two microsecond buckets, e.g.
+ *     {"send_message":{"count":120,"total_us":84000,"buckets_le_us":{"512":80,"1024":40}},...}
+ *   "platform": platform-specific counters (WebSocket reconnect attempts,
+ *     reconnects, disconnects, dropped events, queue depth high-water
+ *     mark), or null if the platform exposes none
+ *
+ * Metrics accumulate until communicator_platform_reset_metrics is called,
+ * so periodic snapshot-and-reset gives per-interval numbers.
+ *
+ * @param platform The platform handle
+ * @return JSON string (must be freed with communicator_free_string), or NULL on error
+ */
+char* communicator_platform_get_metrics(CommunicatorPlatform platform);
+
+/**
+ * Reset all runtime metrics to zero
+ *
+ * Clears the per-operation latency histograms and the platform-specific
+ * counters, starting a fresh measurement window.
+ *
+ * @param platform The platform handle
+ * @return Error code indicating success or failure
+ */
+CommunicatorErrorCode communicator_platform_reset_metrics(CommunicatorPlatform platform);
+
+// ============================================================================
+// Typed Struct API
+// ============================================================================
+// Parallel to the JSON-string API: hot read paths can fetch fixed-field C
+// structs populated directly from the native types, skipping JSON
+// serialization and re-parsing. Variable or platform-specific data
+// (attachments, metadata) is only available through the JSON API.
+
+/**
+ * Channel type constants for the typed struct API
+ */
+typedef enum {
+    COMMUNICATOR_CHANNEL_PUBLIC = 0,
+    COMMUNICATOR_CHANNEL_PRIVATE = 1,
+    COMMUNICATOR_CHANNEL_DIRECT_MESSAGE = 2,
+    COMMUNICATOR_CHANNEL_GROUP_MESSAGE = 3,
+} CommunicatorChannelType;
+
+/**
+ * User status constants for the typed struct API
+ */
+typedef enum {
+    COMMUNICATOR_USER_STATUS_ONLINE = 0,
+    COMMUNICATOR_USER_STATUS_AWAY = 1,
+    COMMUNICATOR_USER_STATUS_DND = 2,
+    COMMUNICATOR_USER_STATUS_OFFLINE = 3,
+    COMMUNICATOR_USER_STATUS_UNKNOWN = 4,
+} CommunicatorUserStatus;
+
+/**
+ * A message with fixed fields
+ * All string fields are owned by the containing list and freed with it
+ */
+typedef struct {
+    char* id;                 /**< Unique message identifier */
+    char* text;               /**< Message text/content */
+    char* sender_id;          /**< User ID of the sender */
+    char* channel_id;         /**< Channel the message was sent to */
+    int64_t created_at;       /**< Creation time (Unix milliseconds) */
+    int64_t edited_at;        /**< Last edit time (Unix milliseconds, 0 if never) */
+    size_t attachment_count;  /**< Number of attachments (details via JSON API) */
+} CommunicatorMessage;
+
+/**
+ * A channel with fixed fields
+ * Optional string fields are NULL when absent
+ */
+typedef struct {
+    char* id;                              /**< Unique channel identifier */
+    char* name;                            /**< Channel name */
+    char* display_name;                    /**< Human-readable display name */
+    char* topic;                           /**< Channel topic (NULL if unset) */
+    char* purpose;                         /**< Channel purpose (NULL if unset) */
+    CommunicatorChannelType channel_type;  /**< Type of channel */
+    int64_t created_at;                    /**< Creation time (Unix milliseconds) */
+    int64_t last_activity_at;              /**< Last activity (Unix milliseconds, 0 if unknown) */
+    int32_t is_archived;                   /**< Whether the channel is archived (0 or 1) */
+} CommunicatorChannel;
+
+/**
+ * A user with fixed fields
+ * Optional string fields are NULL when absent
+ */
+typedef struct {
+    char* id;                       /**< Unique user identifier */
+    char* username;                 /**< Username (unique login name) */
+    char* display_name;             /**< Display name */
+    char* email;                    /**< Email address (NULL if unavailable) */
+    char* avatar_url;               /**< Avatar URL (NULL if unavailable) */
+    char* status_message;           /**< Custom status message (NULL if unset) */
+    CommunicatorUserStatus status;  /**< Current presence status */
+    int32_t is_bot;                 /**< Whether this user is a bot (0 or 1) */
+} CommunicatorUser;
+
+/**
+ * Array container for typed messages
+ */
+typedef struct {
+    CommunicatorMessage* items;  /**< Array of messages (NULL when count is 0) */
+    size_t count;                /**< Number of messages */
+} CommunicatorMessageList;
+
+/**
+ * Array container for typed channels
+ */
+typedef struct {
+    CommunicatorChannel* items;  /**< Array of channels (NULL when count is 0) */
+    size_t count;                /**< Number of channels */
+} CommunicatorChannelList;
+
+/**
+ * Array container for typed users
+ */
+typedef struct {
+    CommunicatorUser* items;  /**< Array of users (NULL when count is 0) */
+    size_t count;             /**< Number of users */
+} CommunicatorUserList;
+
+/**
+ * Get recent messages from a channel as typed structs
+ *
+ * Typed variant of communicator_platform_get_messages(); attachment details
+ * are only available via the JSON API.
+ *
+ * @param platform The platform handle
+ * @param channel_id The channel ID to get messages from
+ * @param limit Maximum number of messages to retrieve
+ * @param out_list Receives the message array
+ *                 Must be freed with communicator_free_message_list()
+ * @return Error code indicating success or failure
+ */
+CommunicatorErrorCode communicator_platform_get_messages_typed(
+    CommunicatorPlatform platform,
+    const char* channel_id,
+    size_t limit,
+    CommunicatorMessageList* out_list
+);
+
+/**
+ * Get all channels for the current user as typed structs
+ *
+ * Typed variant of communicator_platform_get_channels().
+ *
+ * @param platform The platform handle
+ * @param out_list Receives the channel array
+ *                 Must be freed with communicator_free_channel_list()
+ * @return Error code indicating success or failure
+ */
+CommunicatorErrorCode communicator_platform_get_channels_typed(
+    CommunicatorPlatform platform,
+    CommunicatorChannelList* out_list
+);
+
+/**
+ * Get members of a channel as typed structs
+ *
+ * Typed variant of communicator_platform_get_channel_members().
+ *
+ * @param platform The platform handle
+ * @param channel_id The channel ID to get members from
+ * @param out_list Receives the user array
+ *                 Must be freed with communicator_free_user_list()
+ * @return Error code indicating success or failure
+ */
+CommunicatorErrorCode communicator_platform_get_channel_members_typed(
+    CommunicatorPlatform platform,
+    const char* channel_id,
+    CommunicatorUserList* out_list
+);
+
+/**
+ * Free a message list returned by the typed API
+ *
+ * Frees every string field and the array, then resets the list to empty.
+ *
+ * @param list The list to free (safe to pass NULL)
+ */
+void communicator_free_message_list(CommunicatorMessageList* list);
+
+/**
+ * Free a channel list returned by the typed API
+ *
+ * Frees every string field and the array, then resets the list to empty.
+ *
+ * @param list The list to free (safe to pass NULL)
+ */
+void communicator_free_channel_list(CommunicatorChannelList* list);
+
+/**
+ * Free a user list returned by the typed API
+ *
+ * Frees every string field and the array, then resets the list to empty.
+ *
+ * @param list The list to free (safe to pass NULL)
+ */
+void communicator_free_user_list(CommunicatorUserList* list);
+
 // ============================================================================
 // Extended Message Operations
 // ============================================================================
@@ -626,6 +1287,27 @@ char* communicator_platform_search_messages(
     uint32_t limit
 );
 
+/**
+ * Search messages in the local index, falling back to the server
+ *
+ * Queries the embedded message index (configured via the
+ * "message_index.path" context config key) with zero network I/O.
+ * When the index is not configured, performs a server-side search
+ * instead, so this can be used unconditionally.
+ *
+ * @param platform The platform handle
+ * @param query Search terms; all must match (text, channel ID, or sender ID)
+ * @param limit Maximum number of messages to retrieve
+ * @return A JSON array string of Message objects
+ *         Must be freed with communicator_free_string()
+ *         Returns NULL on error
+ */
+char* communicator_platform_search_messages_local(
+    CommunicatorPlatform platform,
+    const char* query,
+    uint32_t limit
+);
+
 // ============================================================================
 // Advanced Search Operations
 // ============================================================================
@@ -769,6 +1451,57 @@ char* communicator_platform_get_messages_before(
     uint32_t limit
 );
 
+// ============================================================================
+// Message Cursor (prefetching pagination)
+// ============================================================================
+
+/**
+ * Opaque handle to a prefetching message history cursor
+ */
+typedef void* CommunicatorMessageCursor;
+
+/**
+ * Open a prefetching cursor over a channel's message history
+ *
+ * The cursor walks the history newest-first in pages of page_size and
+ * prefetches the following page in the background while the caller
+ * consumes the current one, so the network does not sit idle during page
+ * processing. The platform handle must stay valid for the cursor's
+ * lifetime. A cursor is not thread-safe.
+ *
+ * @param platform The platform handle
+ * @param channel_id The channel whose history to iterate
+ * @param page_size Messages per page (must be > 0)
+ * @return A cursor handle (must be freed with
+ *         communicator_message_cursor_free), or NULL on error
+ */
+CommunicatorMessageCursor communicator_platform_open_message_cursor(
+    CommunicatorPlatform platform,
+    const char* channel_id,
+    uint32_t page_size
+);
+
+/**
+ * Get the next page of messages from a cursor
+ *
+ * @param cursor The cursor handle
+ * @return A JSON array string of Message objects, newest first within the
+ *         page. Must be freed with communicator_free_string().
+ *         Returns NULL with no error set when the history is exhausted;
+ *         check communicator_get_last_error() to distinguish end-of-history
+ *         from a failure
+ */
+char* communicator_message_cursor_next(CommunicatorMessageCursor cursor);
+
+/**
+ * Free a message cursor
+ *
+ * Any still-running prefetch is aborted. Passing NULL is a no-op.
+ *
+ * @param cursor The cursor handle
+ */
+void communicator_message_cursor_free(CommunicatorMessageCursor cursor);
+
 /**
  * Get messages after a specific message (pagination)
  *
@@ -1117,6 +1850,27 @@ char* communicator_platform_get_user_status(
     const char* user_id
 );
 
+/**
+ * Get a user's status from the library-maintained status map
+ *
+ * Answers from memory without any network I/O. The map is hydrated once
+ * when events are subscribed and kept current from status push events, so
+ * it is only populated while an event subscription is active. Use
+ * communicator_platform_get_user_status() when a guaranteed-fresh answer
+ * is worth an HTTP round trip.
+ *
+ * @param platform The platform handle
+ * @param user_id The user ID
+ * @return A JSON string representing the status: {"status": "online"},
+ *         or {"status": "unknown"} if no status has been observed yet
+ *         Must be freed with communicator_free_string()
+ *         Returns NULL on error
+ */
+char* communicator_platform_get_user_status_cached(
+    CommunicatorPlatform platform,
+    const char* user_id
+);
+
 /**
  * Get status for multiple users (batch operation)
  *
@@ -1197,6 +1951,43 @@ char* communicator_platform_upload_file(
     const char* file_path
 );
 
+/**
+ * Progress callback function type for streaming uploads
+ *
+ * @param bytes_sent Bytes handed to the transport so far
+ * @param total_bytes Total file size in bytes (0 if unknown)
+ * @param user_data Opaque user data passed to the streaming call
+ */
+typedef void (*CommunicatorUploadProgressCallback)(
+    uint64_t bytes_sent,
+    uint64_t total_bytes,
+    void* user_data
+);
+
+/**
+ * Upload a file, streaming it from disk in bounded chunks
+ *
+ * Streaming variant of communicator_platform_upload_file(): the file is
+ * never read into memory in full, so memory usage stays constant regardless
+ * of file size. The progress callback is invoked as bytes are handed to the
+ * transport.
+ *
+ * @param platform The platform handle
+ * @param channel_id The channel ID where the file will be uploaded
+ * @param file_path Path to the file to upload
+ * @param callback The progress callback (may be NULL)
+ * @param user_data Opaque pointer passed back to the callback
+ * @return A dynamically allocated string containing the file ID (caller must free with communicator_free_string())
+ *         Returns NULL on error
+ */
+char* communicator_platform_upload_file_streaming(
+    CommunicatorPlatform platform,
+    const char* channel_id,
+    const char* file_path,
+    CommunicatorUploadProgressCallback callback,
+    void* user_data
+);
+
 /**
  * Download a file by its ID
  *
@@ -1213,6 +2004,43 @@ CommunicatorErrorCode communicator_platform_download_file(
     size_t* out_size
 );
 
+/**
+ * Chunk callback function type for streaming downloads
+ *
+ * @param data Pointer to the chunk bytes (do NOT free this pointer; it is
+ *             only valid for the duration of the call)
+ * @param size Size of the chunk in bytes
+ * @param user_data Opaque user data passed to the streaming call
+ * @return Non-zero to continue the download, 0 to cancel it
+ */
+typedef int32_t (*CommunicatorDownloadChunkCallback)(
+    const uint8_t* data,
+    size_t size,
+    void* user_data
+);
+
+/**
+ * Download a file, delivering the body in chunks
+ *
+ * Streaming variant of communicator_platform_download_file(): the callback
+ * is invoked with each chunk as it arrives from the network, so memory usage
+ * stays constant regardless of file size and the caller can overlap network
+ * and disk I/O. The call blocks until the download completes, is cancelled
+ * by the callback returning 0, or fails.
+ *
+ * @param platform The platform handle
+ * @param file_id The ID of the file to download
+ * @param callback The chunk callback
+ * @param user_data Opaque pointer passed back to the callback
+ * @return Error code indicating success or failure
+ */
+CommunicatorErrorCode communicator_platform_download_file_streaming(
+    CommunicatorPlatform platform,
+    const char* file_id,
+    CommunicatorDownloadChunkCallback callback,
+    void* user_data
+);
+
 /**
  * Get file metadata without downloading the file
  *
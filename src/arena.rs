@@ -0,0 +1,151 @@
+//! Arena allocator for FFI-returned strings
+//!
+//! Returning a string across the FFI normally costs one heap allocation and
+//! one `communicator_free_string` call per string. Callers that process large
+//! batches can install an arena instead: while an arena is current on a
+//! thread, every string returned by FFI calls on that thread is owned by the
+//! arena, and a single reset or destroy releases the whole batch at once.
+
+use std::cell::Cell;
+use std::ffi::CString;
+use std::os::raw::c_char;
+use std::sync::Mutex;
+
+/// Owns the strings returned by FFI calls while installed as the current
+/// arena, releasing them in bulk on reset or drop
+pub struct Arena {
+    strings: Mutex<Vec<CString>>,
+}
+
+impl Arena {
+    /// Create a new, empty arena
+    pub fn new() -> Self {
+        Arena {
+            strings: Mutex::new(Vec::new()),
+        }
+    }
+
+    /// Take ownership of a string and return a pointer to its contents
+    ///
+    /// The pointer stays valid until the arena is reset or dropped. A CString
+    /// stores its bytes on the heap, so moving it into the arena does not
+    /// move the character data the returned pointer refers to.
+    pub fn adopt(&self, s: CString) -> *mut c_char {
+        let ptr = s.as_ptr() as *mut c_char;
+        if let Ok(mut strings) = self.strings.lock() {
+            strings.push(s);
+        }
+        ptr
+    }
+
+    /// Free every string owned by the arena, keeping the arena reusable
+    pub fn reset(&self) {
+        if let Ok(mut strings) = self.strings.lock() {
+            strings.clear();
+        }
+    }
+
+    /// Number of strings currently owned by the arena
+    pub fn len(&self) -> usize {
+        self.strings.lock().map(|s| s.len()).unwrap_or(0)
+    }
+
+    /// Whether the arena currently owns no strings
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+}
+
+impl Default for Arena {
+    fn default() -> Self {
+        Self::new()
+    }
+}
+
+thread_local! {
+    /// Arena receiving FFI-returned strings on this thread, if any
+    static CURRENT_ARENA: Cell<*const Arena> = const { Cell::new(std::ptr::null()) };
+}
+
+/// Install an arena as the current one for this thread (null to clear)
+///
+/// The caller must keep the arena alive while it is installed.
+pub fn set_current(arena: *const Arena) {
+    CURRENT_ARENA.with(|current| current.set(arena));
+}
+
+/// Clear the current arena on this thread if it matches the given one
+///
+/// Used when an arena is destroyed so this thread is not left pointing at
+/// freed memory.
+pub fn clear_if_current(arena: *const Arena) {
+    CURRENT_ARENA.with(|current| {
+        if current.get() == arena {
+            current.set(std::ptr::null());
+        }
+    });
+}
+
+/// Hand a string to the C side through the current export policy
+///
+/// With an arena installed on this thread the string is adopted by the arena
+/// and freed on reset/destroy; otherwise ownership transfers to the caller,
+/// who must free it with communicator_free_string.
+pub fn export_c_string(s: CString) -> *mut c_char {
+    let arena = CURRENT_ARENA.with(|current| current.get());
+    if arena.is_null() {
+        s.into_raw()
+    } else {
+        // Validity is guaranteed by the FFI contract: the caller keeps the
+        // arena alive while it is installed as current
+        unsafe { (*arena).adopt(s) }
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_adopt_keeps_pointer_valid() {
+        let arena = Arena::new();
+        let ptr = arena.adopt(CString::new("hello").unwrap());
+        // Push more strings to force the Vec to reallocate
+        for i in 0..100 {
+            arena.adopt(CString::new(format!("string-{i}")).unwrap());
+        }
+        let s = unsafe { std::ffi::CStr::from_ptr(ptr) };
+        assert_eq!(s.to_str().unwrap(), "hello");
+        assert_eq!(arena.len(), 101);
+    }
+
+    #[test]
+    fn test_reset_releases_strings() {
+        let arena = Arena::new();
+        arena.adopt(CString::new("a").unwrap());
+        arena.adopt(CString::new("b").unwrap());
+        assert_eq!(arena.len(), 2);
+        arena.reset();
+        assert!(arena.is_empty());
+    }
+
+    #[test]
+    fn test_export_without_arena_transfers_ownership() {
+        // No arena installed: behaves like CString::into_raw
+        let ptr = export_c_string(CString::new("owned").unwrap());
+        let s = unsafe { CString::from_raw(ptr) };
+        assert_eq!(s.to_str().unwrap(), "owned");
+    }
+
+    #[test]
+    fn test_export_with_arena_adopts() {
+        let arena = Arena::new();
+        set_current(&arena);
+        let ptr = export_c_string(CString::new("batched").unwrap());
+        set_current(std::ptr::null());
+
+        assert_eq!(arena.len(), 1);
+        let s = unsafe { std::ffi::CStr::from_ptr(ptr) };
+        assert_eq!(s.to_str().unwrap(), "batched");
+    }
+}
@@ -72,6 +72,19 @@ impl Context {
     }
 
     /// Initialize the context
+    ///
+    /// Recognized configuration keys (set via `set_config` beforehand):
+    /// - `runtime.worker_threads`: size of the shared async runtime's
+    ///   thread pool. Only takes effect if the runtime has not been
+    ///   created yet, so initialize the context before `communicator_init`
+    ///   to apply it.
+    /// - `file_cache.path`: directory for the on-disk file content cache
+    ///   (thumbnails, previews). The cache is disabled unless set.
+    /// - `file_cache.max_bytes`: size budget for the file cache; least
+    ///   recently used entries are evicted past it. Defaults to 256 MiB.
+    /// - `message_index.path`: file backing the local message index used
+    ///   by `communicator_platform_search_messages_local`. The index is
+    ///   disabled unless set.
     pub fn initialize(&mut self) -> Result<()> {
         if self.initialized {
             return Err(Error::new(
@@ -83,6 +96,34 @@ impl Context {
             LogLevel::Info,
             &format!("Initializing context '{}'", self.id),
         );
+
+        if let Some(threads) = self.config.get("runtime.worker_threads") {
+            let threads = threads.parse::<usize>().map_err(|_| {
+                Error::new(
+                    ErrorCode::InvalidArgument,
+                    format!("Invalid runtime.worker_threads value: {threads}"),
+                )
+            })?;
+            crate::runtime::init_runtime_with_threads(threads)?;
+        }
+
+        if let Some(path) = self.config.get("file_cache.path") {
+            let max_bytes = match self.config.get("file_cache.max_bytes") {
+                Some(value) => Some(value.parse::<u64>().map_err(|_| {
+                    Error::new(
+                        ErrorCode::InvalidArgument,
+                        format!("Invalid file_cache.max_bytes value: {value}"),
+                    )
+                })?),
+                None => None,
+            };
+            crate::file_cache::init(path, max_bytes)?;
+        }
+
+        if let Some(path) = self.config.get("message_index.path") {
+            crate::message_index::init(path)?;
+        }
+
         self.initialized = true;
         self.log(LogLevel::Info, "Context initialized successfully");
         Ok(())
@@ -147,6 +188,18 @@ mod tests {
         assert!(!ctx.is_initialized());
     }
 
+    #[test]
+    fn test_worker_threads_config() {
+        let mut ctx = Context::new("test");
+        ctx.set_config("runtime.worker_threads", "2");
+        ctx.initialize().unwrap();
+        assert!(ctx.is_initialized());
+
+        let mut bad = Context::new("test2");
+        bad.set_config("runtime.worker_threads", "lots");
+        assert!(bad.initialize().is_err());
+    }
+
     #[test]
     fn test_double_initialize() {
         let mut ctx = Context::new("test");
@@ -0,0 +1,298 @@
+//! Optional on-disk cache for immutable file content
+//!
+//! Thumbnails, previews, and other file-endpoint responses are immutable
+//! for a given file ID, so re-downloading them is pure waste. This module
+//! provides a process-wide, size-bounded disk cache: a hit returns the
+//! bytes with zero network I/O, a miss falls through to the normal
+//! download path.
+//!
+//! The cache is disabled until configured through the context
+//! (`file_cache.path` and `file_cache.max_bytes` via
+//! `communicator_context_set_config`, applied on
+//! `communicator_context_initialize`). All I/O failures degrade silently
+//! to cache misses - the cache must never surface errors of its own.
+
+use std::collections::HashMap;
+use std::fs;
+use std::path::{Path, PathBuf};
+use std::sync::Mutex;
+use std::sync::OnceLock;
+use std::time::SystemTime;
+
+use crate::error::{Error, ErrorCode, Result};
+
+/// The process-wide cache instance, set once by `init`
+static FILE_CACHE: OnceLock<FileCache> = OnceLock::new();
+
+/// Default size budget when `file_cache.max_bytes` is not given (256 MiB)
+const DEFAULT_MAX_BYTES: u64 = 256 * 1024 * 1024;
+
+/// Initialize the process-wide file cache
+///
+/// Creates the cache directory if needed and scans it so entries persist
+/// across restarts. Only the first call takes effect, mirroring the
+/// shared runtime's initialization semantics.
+pub fn init(path: &str, max_bytes: Option<u64>) -> Result<()> {
+    let cache = FileCache::open(Path::new(path), max_bytes.unwrap_or(DEFAULT_MAX_BYTES))?;
+    let _ = FILE_CACHE.set(cache);
+    Ok(())
+}
+
+/// Look up an entry; None on miss or when the cache is not configured
+pub(crate) fn get(key: &str) -> Option<Vec<u8>> {
+    FILE_CACHE.get().and_then(|cache| cache.get(key))
+}
+
+/// Store an entry; a no-op when the cache is not configured
+pub(crate) fn put(key: &str, bytes: &[u8]) {
+    if let Some(cache) = FILE_CACHE.get() {
+        cache.put(key, bytes);
+    }
+}
+
+/// Size-bounded disk cache with least-recently-used eviction
+///
+/// Each entry is one file whose name is derived from the cache key.
+/// Recency is tracked with an in-memory monotonic stamp bumped on every
+/// put and hit - file mtimes come from the coarse kernel clock and tie
+/// for entries touched within the same tick, which would leave eviction
+/// order to hash-map iteration. Mtimes are still refreshed on a hit so
+/// the startup scan can seed a sensible order across restarts. Writes go
+/// through a temp file and rename so readers never observe partial
+/// content.
+pub struct FileCache {
+    dir: PathBuf,
+    max_bytes: u64,
+    /// Tracked entries currently on disk, used to enforce the budget
+    /// without rescanning the directory on every insert
+    entries: Mutex<CacheEntries>,
+}
+
+struct CacheEntries {
+    map: HashMap<PathBuf, CacheEntry>,
+    /// Monotonic recency clock; higher stamps are more recently used
+    clock: u64,
+}
+
+struct CacheEntry {
+    size: u64,
+    last_used: u64,
+}
+
+impl CacheEntries {
+    /// Stamp an entry as the most recently used
+    fn touch(&mut self, path: PathBuf, size: u64) {
+        self.clock += 1;
+        let last_used = self.clock;
+        self.map.insert(path, CacheEntry { size, last_used });
+    }
+}
+
+impl FileCache {
+    /// Open (or create) a cache directory and index its current contents
+    fn open(dir: &Path, max_bytes: u64) -> Result<Self> {
+        fs::create_dir_all(dir).map_err(|e| {
+            Error::new(
+                ErrorCode::InvalidArgument,
+                format!("Failed to create file cache directory: {e}"),
+            )
+        })?;
+
+        // Seed recency from mtimes, oldest first, so entries that
+        // survived a restart evict in roughly the order they were last
+        // used; from here on recency comes from the in-memory clock
+        let mut scanned: Vec<(PathBuf, u64, SystemTime)> = Vec::new();
+        if let Ok(entries) = fs::read_dir(dir) {
+            for entry in entries.flatten() {
+                if let Ok(meta) = entry.metadata() {
+                    if meta.is_file() {
+                        let mtime = meta.modified().unwrap_or(SystemTime::UNIX_EPOCH);
+                        scanned.push((entry.path(), meta.len(), mtime));
+                    }
+                }
+            }
+        }
+        scanned.sort_by_key(|(_, _, mtime)| *mtime);
+
+        let mut entries = CacheEntries {
+            map: HashMap::new(),
+            clock: 0,
+        };
+        for (path, size, _) in scanned {
+            entries.touch(path, size);
+        }
+
+        Ok(Self {
+            dir: dir.to_path_buf(),
+            max_bytes,
+            entries: Mutex::new(entries),
+        })
+    }
+
+    /// Look up an entry, refreshing its recency stamp (and on-disk
+    /// mtime, for the next startup scan) on a hit so eviction stays
+    /// least-recently-used
+    fn get(&self, key: &str) -> Option<Vec<u8>> {
+        let path = self.entry_path(key);
+        let bytes = fs::read(&path).ok()?;
+        if let Ok(file) = fs::File::open(&path) {
+            let times = fs::FileTimes::new().set_modified(SystemTime::now());
+            let _ = file.set_times(times);
+        }
+        let mut entries = self.entries.lock().unwrap_or_else(|e| e.into_inner());
+        entries.touch(path, bytes.len() as u64);
+        Some(bytes)
+    }
+
+    /// Store an entry, evicting least-recently-used entries when the
+    /// budget is exceeded
+    fn put(&self, key: &str, bytes: &[u8]) {
+        // Entries larger than the whole budget can never fit
+        if bytes.len() as u64 > self.max_bytes {
+            return;
+        }
+
+        let path = self.entry_path(key);
+        let tmp = path.with_extension("tmp");
+        let written = fs::write(&tmp, bytes).is_ok() && fs::rename(&tmp, &path).is_ok();
+        if !written {
+            let _ = fs::remove_file(&tmp);
+            return;
+        }
+
+        let mut entries = self.entries.lock().unwrap_or_else(|e| e.into_inner());
+        entries.touch(path, bytes.len() as u64);
+        self.evict_to_budget(&mut entries);
+    }
+
+    /// Remove least-recently-used entries until the tracked total fits
+    /// the budget
+    fn evict_to_budget(&self, entries: &mut CacheEntries) {
+        let mut total: u64 = entries.map.values().map(|entry| entry.size).sum();
+        if total <= self.max_bytes {
+            return;
+        }
+
+        let mut candidates: Vec<(PathBuf, u64, u64)> = entries
+            .map
+            .iter()
+            .map(|(path, entry)| (path.clone(), entry.size, entry.last_used))
+            .collect();
+        candidates.sort_by_key(|(_, _, last_used)| *last_used);
+
+        for (path, size, _) in candidates {
+            if total <= self.max_bytes {
+                break;
+            }
+            let _ = fs::remove_file(&path);
+            entries.map.remove(&path);
+            total = total.saturating_sub(size);
+        }
+    }
+
+    /// Path of the entry for a key
+    ///
+    /// The file name is the sanitized key plus a hash of the original, so
+    /// distinct keys never collide even when sanitization loses
+    /// characters.
+    fn entry_path(&self, key: &str) -> PathBuf {
+        let sanitized: String = key
+            .chars()
+            .map(|c| {
+                if c.is_ascii_alphanumeric() || c == '-' || c == '.' {
+                    c
+                } else {
+                    '_'
+                }
+            })
+            .collect();
+        self.dir.join(format!("{sanitized}-{:016x}", fnv1a(key)))
+    }
+}
+
+/// FNV-1a hash of a key, used only to derive stable file names
+fn fnv1a(key: &str) -> u64 {
+    let mut hash: u64 = 0xcbf2_9ce4_8422_2325;
+    for byte in key.bytes() {
+        hash ^= u64::from(byte);
+        hash = hash.wrapping_mul(0x0000_0100_0000_01b3);
+    }
+    hash
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn temp_dir(name: &str) -> PathBuf {
+        let dir = std::env::temp_dir().join(format!("communicator-file-cache-{name}"));
+        let _ = fs::remove_dir_all(&dir);
+        dir
+    }
+
+    #[test]
+    fn test_put_get_roundtrip() {
+        let dir = temp_dir("roundtrip");
+        let cache = FileCache::open(&dir, 1024).unwrap();
+
+        assert_eq!(cache.get("thumbnail-abc"), None);
+        cache.put("thumbnail-abc", b"image bytes");
+        assert_eq!(cache.get("thumbnail-abc"), Some(b"image bytes".to_vec()));
+
+        // A new instance over the same directory sees persisted entries
+        let reopened = FileCache::open(&dir, 1024).unwrap();
+        assert_eq!(reopened.get("thumbnail-abc"), Some(b"image bytes".to_vec()));
+
+        let _ = fs::remove_dir_all(&dir);
+    }
+
+    #[test]
+    fn test_eviction_keeps_total_under_budget() {
+        let dir = temp_dir("eviction");
+        let cache = FileCache::open(&dir, 100).unwrap();
+
+        cache.put("a", &[0u8; 40]);
+        cache.put("b", &[0u8; 40]);
+        cache.put("c", &[0u8; 40]);
+
+        let total: u64 = cache
+            .entries
+            .lock()
+            .unwrap()
+            .map
+            .values()
+            .map(|entry| entry.size)
+            .sum();
+        assert!(total <= 100);
+
+        // The newest entry survives eviction
+        assert_eq!(cache.get("c"), Some(vec![0u8; 40]));
+
+        let _ = fs::remove_dir_all(&dir);
+    }
+
+    #[test]
+    fn test_oversized_entry_is_not_cached() {
+        let dir = temp_dir("oversized");
+        let cache = FileCache::open(&dir, 10).unwrap();
+
+        cache.put("big", &[0u8; 64]);
+        assert_eq!(cache.get("big"), None);
+
+        let _ = fs::remove_dir_all(&dir);
+    }
+
+    #[test]
+    fn test_distinct_keys_do_not_collide() {
+        let dir = temp_dir("collide");
+        let cache = FileCache::open(&dir, 1024).unwrap();
+
+        // Same sanitized form, different raw keys
+        cache.put("a/b", b"one");
+        cache.put("a:b", b"two");
+        assert_eq!(cache.get("a/b"), Some(b"one".to_vec()));
+        assert_eq!(cache.get("a:b"), Some(b"two".to_vec()));
+
+        let _ = fs::remove_dir_all(&dir);
+    }
+}
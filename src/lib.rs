@@ -1,9 +1,13 @@
 use std::ffi::CString;
-use std::os::raw::{c_char, c_void};
+use std::os::raw::{c_char, c_int, c_void};
 
 // Core modules
+pub mod arena;
 pub mod context;
 pub mod error;
+pub mod file_cache;
+pub mod message_index;
+pub mod metrics;
 pub mod platforms;
 pub mod runtime;
 pub mod types;
@@ -37,6 +41,70 @@ pub unsafe extern "C" fn communicator_free_string(s: *mut c_char) {
     }
 }
 
+// ============================================================================
+// Arena Allocation
+// ============================================================================
+
+/// Opaque handle to an Arena object
+pub type ArenaHandle = *mut arena::Arena;
+
+/// FFI function: Create a string arena
+/// While installed as current on a thread, every string returned by FFI
+/// calls on that thread is owned by the arena instead of being individually
+/// allocated; a single reset or destroy releases the whole batch.
+/// Returns an opaque handle, or NULL on error
+#[no_mangle]
+pub extern "C" fn communicator_arena_create() -> ArenaHandle {
+    error::clear_last_error();
+    Box::into_raw(Box::new(arena::Arena::new()))
+}
+
+/// FFI function: Install an arena as the current one for the calling thread
+/// Pass NULL to clear and return to per-string ownership. While an arena is
+/// current, strings returned on this thread must NOT be passed to
+/// communicator_free_string - they are freed by arena reset/destroy.
+/// Returns ErrorCode indicating success or failure
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must keep the arena alive while it is installed as current.
+pub unsafe extern "C" fn communicator_arena_set_current(handle: ArenaHandle) -> ErrorCode {
+    error::clear_last_error();
+    arena::set_current(handle);
+    ErrorCode::Success
+}
+
+/// FFI function: Free every string owned by an arena, keeping it reusable
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure no freed string is used after the reset.
+pub unsafe extern "C" fn communicator_arena_reset(handle: ArenaHandle) {
+    if handle.is_null() {
+        return;
+    }
+    (*handle).reset();
+}
+
+/// FFI function: Destroy an arena and free every string it owns
+/// If the arena is current on the calling thread it is cleared first; other
+/// threads must stop using it before it is destroyed.
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure the handle came from communicator_arena_create
+/// and is destroyed exactly once.
+pub unsafe extern "C" fn communicator_arena_destroy(handle: ArenaHandle) {
+    if handle.is_null() {
+        return;
+    }
+    arena::clear_if_current(handle);
+    let _ = Box::from_raw(handle);
+}
+
 // ============================================================================
 // Library Initialization Pattern
 // ============================================================================
@@ -155,7 +223,7 @@ pub unsafe extern "C" fn communicator_last_error_message() -> *mut c_char {
     };
 
     match CString::new(error.message) {
-        Ok(c_string) => c_string.into_raw(),
+        Ok(c_string) => arena::export_c_string(c_string),
         Err(_) => std::ptr::null_mut(),
     }
 }
@@ -363,7 +431,7 @@ pub unsafe extern "C" fn communicator_context_get_config(
 
     match context.get_config(key_str) {
         Some(value) => match CString::new(value.as_str()) {
-            Ok(c_string) => c_string.into_raw(),
+            Ok(c_string) => arena::export_c_string(c_string),
             Err(_) => {
                 error::set_last_error(Error::new(
                     ErrorCode::OutOfMemory,
@@ -539,6 +607,7 @@ pub unsafe extern "C" fn communicator_platform_connect(
     config_json: *const c_char,
 ) -> ErrorCode {
     error::clear_last_error();
+    let _timer = metrics::timer("connect");
 
     if handle.is_null() || config_json.is_null() {
         error::set_last_error(Error::null_pointer());
@@ -641,6 +710,7 @@ pub unsafe extern "C" fn communicator_platform_connect_with_mfa(
 /// The caller must ensure all pointer arguments are valid.
 pub unsafe extern "C" fn communicator_platform_disconnect(handle: PlatformHandle) -> ErrorCode {
     error::clear_last_error();
+    let _timer = metrics::timer("disconnect");
 
     if handle.is_null() {
         error::set_last_error(Error::null_pointer());
@@ -705,7 +775,7 @@ pub unsafe extern "C" fn communicator_platform_get_connection_info(
     match platform.connection_info() {
         Some(info) => match serde_json::to_string(info) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -744,6 +814,7 @@ pub unsafe extern "C" fn communicator_platform_send_message(
     text: *const c_char,
 ) -> *mut c_char {
     error::clear_last_error();
+    let _timer = metrics::timer("send_message");
 
     if handle.is_null() || channel_id.is_null() || text.is_null() {
         error::set_last_error(Error::null_pointer());
@@ -775,7 +846,7 @@ pub unsafe extern "C" fn communicator_platform_send_message(
     match runtime::block_on(platform.send_message(channel_id_str, text_str)) {
         Ok(message) => match serde_json::to_string(&message) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -810,6 +881,7 @@ pub unsafe extern "C" fn communicator_platform_send_message(
 /// The caller must ensure all pointer arguments are valid.
 pub unsafe extern "C" fn communicator_platform_get_channels(handle: PlatformHandle) -> *mut c_char {
     error::clear_last_error();
+    let _timer = metrics::timer("get_channels");
 
     if handle.is_null() {
         error::set_last_error(Error::null_pointer());
@@ -821,7 +893,7 @@ pub unsafe extern "C" fn communicator_platform_get_channels(handle: PlatformHand
     match runtime::block_on(platform.get_channels()) {
         Ok(channels) => match serde_json::to_string(&channels) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -845,6 +917,144 @@ pub unsafe extern "C" fn communicator_platform_get_channels(handle: PlatformHand
     }
 }
 
+/// FFI function: Get only the channels that changed since a timestamp
+/// since_ms is milliseconds since epoch; pass a negative value to continue
+/// from the high-water timestamp of the previous sync (the first such call
+/// returns everything). Returns a JSON object with "created" and "updated"
+/// arrays of Channel objects, a "deleted_ids" array of channel IDs, and
+/// the new high-water timestamp in "synced_at".
+/// The caller must free the returned string using communicator_free_string()
+/// Returns NULL on error
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid.
+pub unsafe extern "C" fn communicator_platform_sync_channels_since(
+    handle: PlatformHandle,
+    since_ms: i64,
+) -> *mut c_char {
+    error::clear_last_error();
+    let _timer = metrics::timer("sync_channels_since");
+
+    if handle.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return std::ptr::null_mut();
+    }
+
+    let platform = &mut **handle;
+
+    match runtime::block_on(platform.sync_channels_since(since_ms)) {
+        Ok(delta) => match serde_json::to_string(&delta) {
+            Ok(json) => match CString::new(json) {
+                Ok(c_string) => arena::export_c_string(c_string),
+                Err(_) => {
+                    error::set_last_error(Error::new(
+                        ErrorCode::OutOfMemory,
+                        "Failed to allocate string",
+                    ));
+                    std::ptr::null_mut()
+                }
+            },
+            Err(e) => {
+                error::set_last_error(Error::new(
+                    ErrorCode::Unknown,
+                    format!("Failed to serialize channel delta: {e}"),
+                ));
+                std::ptr::null_mut()
+            }
+        },
+        Err(e) => {
+            error::set_last_error(e);
+            std::ptr::null_mut()
+        }
+    }
+}
+
+/// FFI function: Fetch the full startup data set in one call
+/// Hydrates the current user, teams, channels, unread counts, and
+/// optionally per-channel members concurrently on the runtime, replacing
+/// the dozens of sequential FFI calls clients otherwise make at startup.
+/// options_json: JSON string with format:
+/// {
+///   "include_members": true   // optional, defaults to true
+/// }
+/// Returns a JSON object with "current_user", "teams", "channels",
+/// "unreads", and a "members" map of channel ID to member arrays.
+/// The caller must free the returned string using communicator_free_string()
+/// Returns NULL on error
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid.
+pub unsafe extern "C" fn communicator_platform_bootstrap(
+    handle: PlatformHandle,
+    options_json: *const c_char,
+) -> *mut c_char {
+    error::clear_last_error();
+    let _timer = metrics::timer("bootstrap");
+
+    if handle.is_null() || options_json.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return std::ptr::null_mut();
+    }
+
+    let options_str = {
+        match std::ffi::CStr::from_ptr(options_json).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return std::ptr::null_mut();
+            }
+        }
+    };
+
+    #[derive(serde::Deserialize)]
+    struct OptionsJson {
+        include_members: Option<bool>,
+    }
+
+    let options: OptionsJson = match serde_json::from_str(options_str) {
+        Ok(options) => options,
+        Err(e) => {
+            error::set_last_error(Error::new(
+                ErrorCode::InvalidArgument,
+                format!("Invalid options JSON: {e}"),
+            ));
+            return std::ptr::null_mut();
+        }
+    };
+
+    let platform = &**handle;
+
+    match runtime::block_on(platform.bootstrap(options.include_members.unwrap_or(true))) {
+        Ok(snapshot) => match serde_json::to_string(&snapshot) {
+            Ok(json) => match CString::new(json) {
+                Ok(c_string) => arena::export_c_string(c_string),
+                Err(_) => {
+                    error::set_last_error(Error::new(
+                        ErrorCode::OutOfMemory,
+                        "Failed to allocate string",
+                    ));
+                    std::ptr::null_mut()
+                }
+            },
+            Err(e) => {
+                error::set_last_error(Error::new(
+                    ErrorCode::Unknown,
+                    format!("Failed to serialize bootstrap snapshot: {e}"),
+                ));
+                std::ptr::null_mut()
+            }
+        },
+        Err(e) => {
+            error::set_last_error(e);
+            std::ptr::null_mut()
+        }
+    }
+}
+
 /// FFI function: Get a specific channel by ID
 /// Returns a JSON string representing the Channel
 /// The caller must free the returned string using communicator_free_string()
@@ -880,7 +1090,7 @@ pub unsafe extern "C" fn communicator_platform_get_channel(
     match runtime::block_on(platform.get_channel(channel_id_str)) {
         Ok(channel) => match serde_json::to_string(&channel) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -904,6 +1114,151 @@ pub unsafe extern "C" fn communicator_platform_get_channel(
     }
 }
 
+// ============================================================================
+// Response Field Masks
+// ============================================================================
+// Hot string-returning APIs serialize every field of Message/User even when
+// the consumer only needs a handful. A per-handle field mask lets the Rust
+// side drop unneeded fields before serialization, shrinking both the JSON
+// generated here and the JSON parsed on the consumer side.
+
+lazy_static::lazy_static! {
+    /// Per-handle response field masks, keyed by platform handle address
+    /// and entity name. Entries are removed when the handle is destroyed.
+    static ref RESPONSE_FIELD_MASKS: std::sync::Mutex<
+        std::collections::HashMap<(usize, &'static str), std::collections::HashSet<String>>,
+    > = std::sync::Mutex::new(std::collections::HashMap::new());
+}
+
+/// Look up the field mask configured for a handle and entity
+fn response_field_mask(
+    handle_addr: usize,
+    entity: &'static str,
+) -> Option<std::collections::HashSet<String>> {
+    RESPONSE_FIELD_MASKS
+        .lock()
+        .ok()
+        .and_then(|masks| masks.get(&(handle_addr, entity)).cloned())
+}
+
+/// Serialize FFI response data, dropping fields outside the handle's mask
+///
+/// Without a configured mask this is a plain `serde_json::to_string`, so
+/// the default path pays no Value round trip.
+fn serialize_masked<T: serde::Serialize>(
+    handle_addr: usize,
+    entity: &'static str,
+    data: &T,
+) -> serde_json::Result<String> {
+    match response_field_mask(handle_addr, entity) {
+        None => serde_json::to_string(data),
+        Some(mask) => {
+            let mut value = serde_json::to_value(data)?;
+            apply_field_mask(&mut value, &mask);
+            serde_json::to_string(&value)
+        }
+    }
+}
+
+/// Retain only masked keys on an object, or on each element of an array
+fn apply_field_mask(value: &mut serde_json::Value, mask: &std::collections::HashSet<String>) {
+    match value {
+        serde_json::Value::Array(items) => {
+            for item in items {
+                apply_field_mask(item, mask);
+            }
+        }
+        serde_json::Value::Object(map) => {
+            map.retain(|key, _| mask.contains(key));
+        }
+        _ => {}
+    }
+}
+
+/// FFI function: Configure which fields string-returning APIs serialize
+/// entity selects the response type the mask applies to: "message"
+/// (get_messages, get_messages_before/after) or "user"
+/// (get_channel_members). fields_json is a JSON array of field names to
+/// keep, e.g. ["id","text","created_at"]; an empty array clears the mask
+/// and restores full serialization. Unknown field names are allowed and
+/// simply match nothing. The mask applies to this handle only.
+/// Returns ErrorCode indicating success or failure
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid.
+pub unsafe extern "C" fn communicator_platform_set_response_fields(
+    handle: PlatformHandle,
+    entity: *const c_char,
+    fields_json: *const c_char,
+) -> ErrorCode {
+    error::clear_last_error();
+
+    if handle.is_null() || entity.is_null() || fields_json.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return ErrorCode::NullPointer;
+    }
+
+    let entity_str = {
+        match std::ffi::CStr::from_ptr(entity).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return ErrorCode::InvalidUtf8;
+            }
+        }
+    };
+
+    // Canonicalize to the 'static names used as registry keys
+    let entity_key: &'static str = match entity_str {
+        "message" => "message",
+        "user" => "user",
+        _ => {
+            error::set_last_error(Error::new(
+                ErrorCode::InvalidArgument,
+                format!("Unknown response entity: {entity_str} (expected \"message\" or \"user\")"),
+            ));
+            return ErrorCode::InvalidArgument;
+        }
+    };
+
+    let fields_str = {
+        match std::ffi::CStr::from_ptr(fields_json).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return ErrorCode::InvalidUtf8;
+            }
+        }
+    };
+
+    let fields: Vec<String> = match serde_json::from_str(fields_str) {
+        Ok(fields) => fields,
+        Err(e) => {
+            error::set_last_error(Error::new(
+                ErrorCode::InvalidArgument,
+                format!("Invalid fields JSON: {e}"),
+            ));
+            return ErrorCode::InvalidArgument;
+        }
+    };
+
+    let Ok(mut masks) = RESPONSE_FIELD_MASKS.lock() else {
+        error::set_last_error(Error::new(
+            ErrorCode::Unknown,
+            "Field mask registry unavailable",
+        ));
+        return ErrorCode::Unknown;
+    };
+    if fields.is_empty() {
+        masks.remove(&(handle as usize, entity_key));
+    } else {
+        masks.insert((handle as usize, entity_key), fields.into_iter().collect());
+    }
+    ErrorCode::Success
+}
+
 /// FFI function: Get recent messages from a channel
 /// Returns a JSON array string of Message objects
 /// The caller must free the returned string using communicator_free_string()
@@ -919,6 +1274,7 @@ pub unsafe extern "C" fn communicator_platform_get_messages(
     limit: u32,
 ) -> *mut c_char {
     error::clear_last_error();
+    let _timer = metrics::timer("get_messages");
 
     if handle.is_null() || channel_id.is_null() {
         error::set_last_error(Error::null_pointer());
@@ -938,9 +1294,9 @@ pub unsafe extern "C" fn communicator_platform_get_messages(
     let platform = &**handle;
 
     match runtime::block_on(platform.get_messages(channel_id_str, limit as usize)) {
-        Ok(messages) => match serde_json::to_string(&messages) {
+        Ok(messages) => match serialize_masked(handle as usize, "message", &messages) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -978,6 +1334,7 @@ pub unsafe extern "C" fn communicator_platform_get_channel_members(
     channel_id: *const c_char,
 ) -> *mut c_char {
     error::clear_last_error();
+    let _timer = metrics::timer("get_channel_members");
 
     if handle.is_null() || channel_id.is_null() {
         error::set_last_error(Error::null_pointer());
@@ -997,9 +1354,9 @@ pub unsafe extern "C" fn communicator_platform_get_channel_members(
     let platform = &**handle;
 
     match runtime::block_on(platform.get_channel_members(channel_id_str)) {
-        Ok(users) => match serde_json::to_string(&users) {
+        Ok(users) => match serialize_masked(handle as usize, "user", &users) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -1023,6 +1380,72 @@ pub unsafe extern "C" fn communicator_platform_get_channel_members(
     }
 }
 
+/// FFI function: Get members for many channels in one aggregated call
+/// channel_ids_json is a JSON array of channel IDs, e.g. ["ch1","ch2"].
+/// The channels are fetched concurrently with bounded parallelism instead
+/// of one serialized round trip per channel. Returns a JSON string mapping
+/// each channel ID to {"members": [...]} on success or
+/// {"error": {"code": ..., "message": ...}} on failure, so one failing
+/// channel does not abort the batch.
+/// The caller must free the returned string using communicator_free_string()
+/// Returns NULL on error
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid.
+pub unsafe extern "C" fn communicator_platform_get_channel_members_bulk(
+    handle: PlatformHandle,
+    channel_ids_json: *const c_char,
+) -> *mut c_char {
+    error::clear_last_error();
+
+    if handle.is_null() || channel_ids_json.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return std::ptr::null_mut();
+    }
+
+    let channel_ids_str = {
+        match std::ffi::CStr::from_ptr(channel_ids_json).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return std::ptr::null_mut();
+            }
+        }
+    };
+
+    let channel_ids: Vec<String> = match serde_json::from_str(channel_ids_str) {
+        Ok(ids) => ids,
+        Err(e) => {
+            error::set_last_error(Error::new(
+                ErrorCode::InvalidArgument,
+                format!("Expected a JSON array of channel IDs: {e}"),
+            ));
+            return std::ptr::null_mut();
+        }
+    };
+
+    let platform = &**handle;
+
+    match runtime::block_on(platform.get_channel_members_bulk(channel_ids)) {
+        Ok(json) => match CString::new(json) {
+            Ok(c_string) => arena::export_c_string(c_string),
+            Err(_) => {
+                error::set_last_error(Error::new(
+                    ErrorCode::OutOfMemory,
+                    "Failed to allocate string",
+                ));
+                std::ptr::null_mut()
+            }
+        },
+        Err(e) => {
+            error::set_last_error(e);
+            std::ptr::null_mut()
+        }
+    }
+}
+
 /// FFI function: Get a specific user by ID
 /// Returns a JSON string representing the User
 /// The caller must free the returned string using communicator_free_string()
@@ -1037,6 +1460,7 @@ pub unsafe extern "C" fn communicator_platform_get_user(
     user_id: *const c_char,
 ) -> *mut c_char {
     error::clear_last_error();
+    let _timer = metrics::timer("get_user");
 
     if handle.is_null() || user_id.is_null() {
         error::set_last_error(Error::null_pointer());
@@ -1058,7 +1482,7 @@ pub unsafe extern "C" fn communicator_platform_get_user(
     match runtime::block_on(platform.get_user(user_id_str)) {
         Ok(user) => match serde_json::to_string(&user) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -1106,7 +1530,7 @@ pub unsafe extern "C" fn communicator_platform_get_current_user(
     match runtime::block_on(platform.get_current_user()) {
         Ok(user) => match serde_json::to_string(&user) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -1165,7 +1589,7 @@ pub unsafe extern "C" fn communicator_platform_create_direct_channel(
     match runtime::block_on(platform.create_direct_channel(user_id_str)) {
         Ok(channel) => match serde_json::to_string(&channel) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -1256,7 +1680,7 @@ pub unsafe extern "C" fn communicator_platform_create_channel(
     )) {
         Ok(channel) => match serde_json::to_string(&channel) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -1369,7 +1793,7 @@ pub unsafe extern "C" fn communicator_platform_update_channel(
     )) {
         Ok(channel) => match serde_json::to_string(&channel) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -1461,7 +1885,7 @@ pub unsafe extern "C" fn communicator_platform_get_teams(handle: PlatformHandle)
     match runtime::block_on(platform.get_teams()) {
         Ok(teams) => match serde_json::to_string(&teams) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -1520,7 +1944,7 @@ pub unsafe extern "C" fn communicator_platform_get_team(
     match runtime::block_on(platform.get_team(team_id_str)) {
         Ok(team) => match serde_json::to_string(&team) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -1603,6 +2027,79 @@ pub unsafe extern "C" fn communicator_platform_set_status(
     }
 }
 
+/// FFI function: Get a user's status from the library-maintained status map
+/// Answers from memory without any network I/O: the map is hydrated when
+/// events are subscribed and kept current from status push events. Returns
+/// {"status": "unknown"} for users whose status has not been observed yet.
+/// The caller must free the returned string using communicator_free_string()
+/// Returns NULL on error
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid.
+pub unsafe extern "C" fn communicator_platform_get_user_status_cached(
+    handle: PlatformHandle,
+    user_id: *const c_char,
+) -> *mut c_char {
+    error::clear_last_error();
+
+    if handle.is_null() || user_id.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return std::ptr::null_mut();
+    }
+
+    let user_id_str = {
+        match std::ffi::CStr::from_ptr(user_id).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return std::ptr::null_mut();
+            }
+        }
+    };
+
+    let platform = &**handle;
+
+    match runtime::block_on(platform.get_user_status_cached(user_id_str)) {
+        Ok(status) => {
+            let status_str = match status {
+                crate::types::user::UserStatus::Online => "online",
+                crate::types::user::UserStatus::Away => "away",
+                crate::types::user::UserStatus::DoNotDisturb => "dnd",
+                crate::types::user::UserStatus::Offline => "offline",
+                crate::types::user::UserStatus::Unknown => "unknown",
+            };
+
+            let json = serde_json::json!({"status": status_str});
+
+            match serde_json::to_string(&json) {
+                Ok(json_str) => match CString::new(json_str) {
+                    Ok(c_string) => arena::export_c_string(c_string),
+                    Err(_) => {
+                        error::set_last_error(Error::new(
+                            ErrorCode::OutOfMemory,
+                            "Failed to allocate string",
+                        ));
+                        std::ptr::null_mut()
+                    }
+                },
+                Err(e) => {
+                    error::set_last_error(Error::new(
+                        ErrorCode::Unknown,
+                        format!("Failed to serialize status: {e}"),
+                    ));
+                    std::ptr::null_mut()
+                }
+            }
+        }
+        Err(e) => {
+            error::set_last_error(e);
+            std::ptr::null_mut()
+        }
+    }
+}
+
 /// FFI function: Get a user's status
 /// Returns a JSON string representing the status: {"status": "online"}
 /// The caller must free the returned string using communicator_free_string()
@@ -1650,7 +2147,7 @@ pub unsafe extern "C" fn communicator_platform_get_user_status(
 
             match serde_json::to_string(&json) {
                 Ok(json_str) => match CString::new(json_str) {
-                    Ok(c_string) => c_string.into_raw(),
+                    Ok(c_string) => arena::export_c_string(c_string),
                     Err(_) => {
                         error::set_last_error(Error::new(
                             ErrorCode::OutOfMemory,
@@ -1894,6 +2391,7 @@ pub unsafe extern "C" fn communicator_platform_unsubscribe_events(
 /// The caller must ensure all pointer arguments are valid.
 pub unsafe extern "C" fn communicator_platform_poll_event(handle: PlatformHandle) -> *mut c_char {
     error::clear_last_error();
+    let _timer = metrics::timer("poll_event");
 
     if handle.is_null() {
         error::set_last_error(Error::null_pointer());
@@ -1904,355 +2402,11 @@ pub unsafe extern "C" fn communicator_platform_poll_event(handle: PlatformHandle
 
     match runtime::block_on(platform.poll_event()) {
         Ok(Some(event)) => {
-            // Serialize the event to JSON
-            // Note: PlatformEvent enum needs custom serialization
-            let json = match event {
-                PlatformEvent::MessagePosted(msg) => {
-                    serde_json::json!({
-                        "type": "message_posted",
-                        "data": msg
-                    })
-                }
-                PlatformEvent::MessageUpdated(msg) => {
-                    serde_json::json!({
-                        "type": "message_updated",
-                        "data": msg
-                    })
-                }
-                PlatformEvent::MessageDeleted {
-                    message_id,
-                    channel_id,
-                } => {
-                    serde_json::json!({
-                        "type": "message_deleted",
-                        "message_id": message_id,
-                        "channel_id": channel_id
-                    })
-                }
-                PlatformEvent::UserStatusChanged { user_id, status } => {
-                    serde_json::json!({
-                        "type": "user_status_changed",
-                        "user_id": user_id,
-                        "status": status
-                    })
-                }
-                PlatformEvent::UserTyping {
-                    user_id,
-                    channel_id,
-                } => {
-                    serde_json::json!({
-                        "type": "user_typing",
-                        "user_id": user_id,
-                        "channel_id": channel_id
-                    })
-                }
-                PlatformEvent::ChannelCreated(channel) => {
-                    serde_json::json!({
-                        "type": "channel_created",
-                        "data": channel
-                    })
-                }
-                PlatformEvent::ChannelUpdated(channel) => {
-                    serde_json::json!({
-                        "type": "channel_updated",
-                        "data": channel
-                    })
-                }
-                PlatformEvent::ChannelDeleted { channel_id } => {
-                    serde_json::json!({
-                        "type": "channel_deleted",
-                        "channel_id": channel_id
-                    })
-                }
-                PlatformEvent::UserJoinedChannel {
-                    user_id,
-                    channel_id,
-                } => {
-                    serde_json::json!({
-                        "type": "user_joined_channel",
-                        "user_id": user_id,
-                        "channel_id": channel_id
-                    })
-                }
-                PlatformEvent::UserLeftChannel {
-                    user_id,
-                    channel_id,
-                } => {
-                    serde_json::json!({
-                        "type": "user_left_channel",
-                        "user_id": user_id,
-                        "channel_id": channel_id
-                    })
-                }
-                PlatformEvent::ConnectionStateChanged(state) => {
-                    serde_json::json!({
-                        "type": "connection_state_changed",
-                        "state": state
-                    })
-                }
-                PlatformEvent::ReactionAdded {
-                    message_id,
-                    user_id,
-                    emoji_name,
-                    channel_id,
-                } => {
-                    serde_json::json!({
-                        "type": "reaction_added",
-                        "message_id": message_id,
-                        "user_id": user_id,
-                        "emoji_name": emoji_name,
-                        "channel_id": channel_id
-                    })
-                }
-                PlatformEvent::ReactionRemoved {
-                    message_id,
-                    user_id,
-                    emoji_name,
-                    channel_id,
-                } => {
-                    serde_json::json!({
-                        "type": "reaction_removed",
-                        "message_id": message_id,
-                        "user_id": user_id,
-                        "emoji_name": emoji_name,
-                        "channel_id": channel_id
-                    })
-                }
-                PlatformEvent::DirectChannelAdded { channel_id } => {
-                    serde_json::json!({
-                        "type": "direct_channel_added",
-                        "channel_id": channel_id
-                    })
-                }
-                PlatformEvent::GroupChannelAdded { channel_id } => {
-                    serde_json::json!({
-                        "type": "group_channel_added",
-                        "channel_id": channel_id
-                    })
-                }
-                PlatformEvent::PreferenceChanged {
-                    category,
-                    name,
-                    value,
-                } => {
-                    serde_json::json!({
-                        "type": "preference_changed",
-                        "category": category,
-                        "name": name,
-                        "value": value
-                    })
-                }
-                PlatformEvent::EphemeralMessage {
-                    message,
-                    channel_id,
-                } => {
-                    serde_json::json!({
-                        "type": "ephemeral_message",
-                        "message": message,
-                        "channel_id": channel_id
-                    })
-                }
-                PlatformEvent::UserAdded { user_id } => {
-                    serde_json::json!({
-                        "type": "user_added",
-                        "user_id": user_id
-                    })
-                }
-                PlatformEvent::UserUpdated { user_id } => {
-                    serde_json::json!({
-                        "type": "user_updated",
-                        "user_id": user_id
-                    })
-                }
-                PlatformEvent::UserRoleUpdated { user_id } => {
-                    serde_json::json!({
-                        "type": "user_role_updated",
-                        "user_id": user_id
-                    })
-                }
-                PlatformEvent::ChannelViewed {
-                    user_id,
-                    channel_id,
-                } => {
-                    serde_json::json!({
-                        "type": "channel_viewed",
-                        "user_id": user_id,
-                        "channel_id": channel_id
-                    })
-                }
-                PlatformEvent::ThreadUpdated {
-                    thread_id,
-                    channel_id,
-                } => {
-                    serde_json::json!({
-                        "type": "thread_updated",
-                        "thread_id": thread_id,
-                        "channel_id": channel_id
-                    })
-                }
-                PlatformEvent::ThreadReadChanged {
-                    thread_id,
-                    user_id,
-                    channel_id,
-                } => {
-                    serde_json::json!({
-                        "type": "thread_read_changed",
-                        "thread_id": thread_id,
-                        "user_id": user_id,
-                        "channel_id": channel_id
-                    })
-                }
-                PlatformEvent::ThreadFollowChanged {
-                    thread_id,
-                    user_id,
-                    channel_id,
-                    following,
-                } => {
-                    serde_json::json!({
-                        "type": "thread_follow_changed",
-                        "thread_id": thread_id,
-                        "user_id": user_id,
-                        "channel_id": channel_id,
-                        "following": following
-                    })
-                }
-                PlatformEvent::PostUnread {
-                    post_id,
-                    channel_id,
-                    user_id,
-                } => {
-                    serde_json::json!({
-                        "type": "post_unread",
-                        "post_id": post_id,
-                        "channel_id": channel_id,
-                        "user_id": user_id
-                    })
-                }
-                PlatformEvent::EmojiAdded {
-                    emoji_id,
-                    emoji_name,
-                } => {
-                    serde_json::json!({
-                        "type": "emoji_added",
-                        "emoji_id": emoji_id,
-                        "emoji_name": emoji_name
-                    })
-                }
-                PlatformEvent::AddedToTeam { team_id, user_id } => {
-                    serde_json::json!({
-                        "type": "added_to_team",
-                        "team_id": team_id,
-                        "user_id": user_id
-                    })
-                }
-                PlatformEvent::LeftTeam { team_id, user_id } => {
-                    serde_json::json!({
-                        "type": "left_team",
-                        "team_id": team_id,
-                        "user_id": user_id
-                    })
-                }
-                PlatformEvent::ConfigChanged => {
-                    serde_json::json!({
-                        "type": "config_changed"
-                    })
-                }
-                PlatformEvent::LicenseChanged => {
-                    serde_json::json!({
-                        "type": "license_changed"
-                    })
-                }
-                PlatformEvent::ChannelConverted { channel_id } => {
-                    serde_json::json!({
-                        "type": "channel_converted",
-                        "channel_id": channel_id
-                    })
-                }
-                PlatformEvent::ChannelMemberUpdated {
-                    channel_id,
-                    user_id,
-                } => {
-                    serde_json::json!({
-                        "type": "channel_member_updated",
-                        "channel_id": channel_id,
-                        "user_id": user_id
-                    })
-                }
-                PlatformEvent::TeamDeleted { team_id } => {
-                    serde_json::json!({
-                        "type": "team_deleted",
-                        "team_id": team_id
-                    })
-                }
-                PlatformEvent::TeamUpdated { team_id } => {
-                    serde_json::json!({
-                        "type": "team_updated",
-                        "team_id": team_id
-                    })
-                }
-                PlatformEvent::MemberRoleUpdated {
-                    channel_id,
-                    user_id,
-                } => {
-                    serde_json::json!({
-                        "type": "member_role_updated",
-                        "channel_id": channel_id,
-                        "user_id": user_id
-                    })
-                }
-                PlatformEvent::PluginDisabled { plugin_id } => {
-                    serde_json::json!({
-                        "type": "plugin_disabled",
-                        "plugin_id": plugin_id
-                    })
-                }
-                PlatformEvent::PluginEnabled { plugin_id } => {
-                    serde_json::json!({
-                        "type": "plugin_enabled",
-                        "plugin_id": plugin_id
-                    })
-                }
-                PlatformEvent::PluginStatusesChanged => {
-                    serde_json::json!({
-                        "type": "plugin_statuses_changed"
-                    })
-                }
-                PlatformEvent::PreferencesDeleted { category, name } => {
-                    serde_json::json!({
-                        "type": "preferences_deleted",
-                        "category": category,
-                        "name": name
-                    })
-                }
-                PlatformEvent::Response {
-                    status,
-                    seq_reply,
-                    error,
-                } => {
-                    serde_json::json!({
-                        "type": "response",
-                        "status": status,
-                        "seq_reply": seq_reply,
-                        "error": error
-                    })
-                }
-                PlatformEvent::DialogOpened { dialog_id } => {
-                    serde_json::json!({
-                        "type": "dialog_opened",
-                        "dialog_id": dialog_id
-                    })
-                }
-                PlatformEvent::RoleUpdated { role_id } => {
-                    serde_json::json!({
-                        "type": "role_updated",
-                        "role_id": role_id
-                    })
-                }
-            };
+            let json = platform_event_to_json(event);
 
             match serde_json::to_string(&json) {
                 Ok(json_str) => match CString::new(json_str) {
-                    Ok(c_string) => c_string.into_raw(),
+                    Ok(c_string) => arena::export_c_string(c_string),
                     Err(_) => {
                         error::set_last_error(Error::new(
                             ErrorCode::OutOfMemory,
@@ -2281,171 +2435,1874 @@ pub unsafe extern "C" fn communicator_platform_poll_event(handle: PlatformHandle
     }
 }
 
-// ============================================================================
-// Extended Platform FFI Functions
-// ============================================================================
+/// Serialize a PlatformEvent to its JSON representation
+/// Note: PlatformEvent enum needs custom serialization
+/// Shared by communicator_platform_poll_event and communicator_platform_poll_events_batch
+fn platform_event_to_json(event: PlatformEvent) -> serde_json::Value {
+    match event {
+        PlatformEvent::MessagePosted(msg) => {
+            serde_json::json!({
+                "type": "message_posted",
+                "data": msg
+            })
+        }
+        PlatformEvent::MessageUpdated(msg) => {
+            serde_json::json!({
+                "type": "message_updated",
+                "data": msg
+            })
+        }
+        PlatformEvent::MessageDeleted {
+            message_id,
+            channel_id,
+        } => {
+            serde_json::json!({
+                "type": "message_deleted",
+                "message_id": message_id,
+                "channel_id": channel_id
+            })
+        }
+        PlatformEvent::UserStatusChanged { user_id, status } => {
+            serde_json::json!({
+                "type": "user_status_changed",
+                "user_id": user_id,
+                "status": status
+            })
+        }
+        PlatformEvent::UserTyping {
+            user_id,
+            channel_id,
+        } => {
+            serde_json::json!({
+                "type": "user_typing",
+                "user_id": user_id,
+                "channel_id": channel_id
+            })
+        }
+        PlatformEvent::ChannelCreated(channel) => {
+            serde_json::json!({
+                "type": "channel_created",
+                "data": channel
+            })
+        }
+        PlatformEvent::ChannelUpdated(channel) => {
+            serde_json::json!({
+                "type": "channel_updated",
+                "data": channel
+            })
+        }
+        PlatformEvent::ChannelDeleted { channel_id } => {
+            serde_json::json!({
+                "type": "channel_deleted",
+                "channel_id": channel_id
+            })
+        }
+        PlatformEvent::UserJoinedChannel {
+            user_id,
+            channel_id,
+        } => {
+            serde_json::json!({
+                "type": "user_joined_channel",
+                "user_id": user_id,
+                "channel_id": channel_id
+            })
+        }
+        PlatformEvent::UserLeftChannel {
+            user_id,
+            channel_id,
+        } => {
+            serde_json::json!({
+                "type": "user_left_channel",
+                "user_id": user_id,
+                "channel_id": channel_id
+            })
+        }
+        PlatformEvent::ConnectionStateChanged(state) => {
+            serde_json::json!({
+                "type": "connection_state_changed",
+                "state": state
+            })
+        }
+        PlatformEvent::ReactionAdded {
+            message_id,
+            user_id,
+            emoji_name,
+            channel_id,
+        } => {
+            serde_json::json!({
+                "type": "reaction_added",
+                "message_id": message_id,
+                "user_id": user_id,
+                "emoji_name": emoji_name,
+                "channel_id": channel_id
+            })
+        }
+        PlatformEvent::ReactionRemoved {
+            message_id,
+            user_id,
+            emoji_name,
+            channel_id,
+        } => {
+            serde_json::json!({
+                "type": "reaction_removed",
+                "message_id": message_id,
+                "user_id": user_id,
+                "emoji_name": emoji_name,
+                "channel_id": channel_id
+            })
+        }
+        PlatformEvent::DirectChannelAdded { channel_id } => {
+            serde_json::json!({
+                "type": "direct_channel_added",
+                "channel_id": channel_id
+            })
+        }
+        PlatformEvent::GroupChannelAdded { channel_id } => {
+            serde_json::json!({
+                "type": "group_channel_added",
+                "channel_id": channel_id
+            })
+        }
+        PlatformEvent::PreferenceChanged {
+            category,
+            name,
+            value,
+        } => {
+            serde_json::json!({
+                "type": "preference_changed",
+                "category": category,
+                "name": name,
+                "value": value
+            })
+        }
+        PlatformEvent::EphemeralMessage {
+            message,
+            channel_id,
+        } => {
+            serde_json::json!({
+                "type": "ephemeral_message",
+                "message": message,
+                "channel_id": channel_id
+            })
+        }
+        PlatformEvent::UserAdded { user_id } => {
+            serde_json::json!({
+                "type": "user_added",
+                "user_id": user_id
+            })
+        }
+        PlatformEvent::UserUpdated { user_id } => {
+            serde_json::json!({
+                "type": "user_updated",
+                "user_id": user_id
+            })
+        }
+        PlatformEvent::UserRoleUpdated { user_id } => {
+            serde_json::json!({
+                "type": "user_role_updated",
+                "user_id": user_id
+            })
+        }
+        PlatformEvent::ChannelViewed {
+            user_id,
+            channel_id,
+        } => {
+            serde_json::json!({
+                "type": "channel_viewed",
+                "user_id": user_id,
+                "channel_id": channel_id
+            })
+        }
+        PlatformEvent::ThreadUpdated {
+            thread_id,
+            channel_id,
+        } => {
+            serde_json::json!({
+                "type": "thread_updated",
+                "thread_id": thread_id,
+                "channel_id": channel_id
+            })
+        }
+        PlatformEvent::ThreadReadChanged {
+            thread_id,
+            user_id,
+            channel_id,
+        } => {
+            serde_json::json!({
+                "type": "thread_read_changed",
+                "thread_id": thread_id,
+                "user_id": user_id,
+                "channel_id": channel_id
+            })
+        }
+        PlatformEvent::ThreadFollowChanged {
+            thread_id,
+            user_id,
+            channel_id,
+            following,
+        } => {
+            serde_json::json!({
+                "type": "thread_follow_changed",
+                "thread_id": thread_id,
+                "user_id": user_id,
+                "channel_id": channel_id,
+                "following": following
+            })
+        }
+        PlatformEvent::PostUnread {
+            post_id,
+            channel_id,
+            user_id,
+        } => {
+            serde_json::json!({
+                "type": "post_unread",
+                "post_id": post_id,
+                "channel_id": channel_id,
+                "user_id": user_id
+            })
+        }
+        PlatformEvent::EmojiAdded {
+            emoji_id,
+            emoji_name,
+        } => {
+            serde_json::json!({
+                "type": "emoji_added",
+                "emoji_id": emoji_id,
+                "emoji_name": emoji_name
+            })
+        }
+        PlatformEvent::AddedToTeam { team_id, user_id } => {
+            serde_json::json!({
+                "type": "added_to_team",
+                "team_id": team_id,
+                "user_id": user_id
+            })
+        }
+        PlatformEvent::LeftTeam { team_id, user_id } => {
+            serde_json::json!({
+                "type": "left_team",
+                "team_id": team_id,
+                "user_id": user_id
+            })
+        }
+        PlatformEvent::ConfigChanged => {
+            serde_json::json!({
+                "type": "config_changed"
+            })
+        }
+        PlatformEvent::LicenseChanged => {
+            serde_json::json!({
+                "type": "license_changed"
+            })
+        }
+        PlatformEvent::ChannelConverted { channel_id } => {
+            serde_json::json!({
+                "type": "channel_converted",
+                "channel_id": channel_id
+            })
+        }
+        PlatformEvent::ChannelMemberUpdated {
+            channel_id,
+            user_id,
+        } => {
+            serde_json::json!({
+                "type": "channel_member_updated",
+                "channel_id": channel_id,
+                "user_id": user_id
+            })
+        }
+        PlatformEvent::TeamDeleted { team_id } => {
+            serde_json::json!({
+                "type": "team_deleted",
+                "team_id": team_id
+            })
+        }
+        PlatformEvent::TeamUpdated { team_id } => {
+            serde_json::json!({
+                "type": "team_updated",
+                "team_id": team_id
+            })
+        }
+        PlatformEvent::MemberRoleUpdated {
+            channel_id,
+            user_id,
+        } => {
+            serde_json::json!({
+                "type": "member_role_updated",
+                "channel_id": channel_id,
+                "user_id": user_id
+            })
+        }
+        PlatformEvent::PluginDisabled { plugin_id } => {
+            serde_json::json!({
+                "type": "plugin_disabled",
+                "plugin_id": plugin_id
+            })
+        }
+        PlatformEvent::PluginEnabled { plugin_id } => {
+            serde_json::json!({
+                "type": "plugin_enabled",
+                "plugin_id": plugin_id
+            })
+        }
+        PlatformEvent::PluginStatusesChanged => {
+            serde_json::json!({
+                "type": "plugin_statuses_changed"
+            })
+        }
+        PlatformEvent::PreferencesDeleted { category, name } => {
+            serde_json::json!({
+                "type": "preferences_deleted",
+                "category": category,
+                "name": name
+            })
+        }
+        PlatformEvent::Response {
+            status,
+            seq_reply,
+            error,
+        } => {
+            serde_json::json!({
+                "type": "response",
+                "status": status,
+                "seq_reply": seq_reply,
+                "error": error
+            })
+        }
+        PlatformEvent::DialogOpened { dialog_id } => {
+            serde_json::json!({
+                "type": "dialog_opened",
+                "dialog_id": dialog_id
+            })
+        }
+        PlatformEvent::RoleUpdated { role_id } => {
+            serde_json::json!({
+                "type": "role_updated",
+                "role_id": role_id
+            })
+        }
+    }
+}
 
-/// FFI function: Send a reply to a message (threaded conversation)
-/// Returns a JSON string representing the created Message
-/// The caller must free the returned string using communicator_free_string()
-/// Returns NULL on error
+/// FFI function: Poll for multiple events in a single call
+/// Drains up to max_events queued events into an array of JSON strings, amortizing
+/// the FFI crossing and runtime entry cost across the whole batch.
+/// On success, *out_events points to an array of *out_count JSON strings
+/// (same format as communicator_platform_poll_event).
+/// The array must be freed with communicator_free_event_batch().
+/// If no events are available, *out_count is set to 0 and *out_events to NULL.
+/// Returns ErrorCode indicating success or failure
 #[no_mangle]
 ///
 /// # Safety
 /// This function is unsafe because it deals with raw pointers from C.
 /// The caller must ensure all pointer arguments are valid.
-pub unsafe extern "C" fn communicator_platform_send_reply(
+pub unsafe extern "C" fn communicator_platform_poll_events_batch(
     handle: PlatformHandle,
-    channel_id: *const c_char,
-    text: *const c_char,
-    root_id: *const c_char,
-) -> *mut c_char {
+    max_events: usize,
+    out_events: *mut *mut *mut c_char,
+    out_count: *mut usize,
+) -> ErrorCode {
     error::clear_last_error();
+    let _timer = metrics::timer("poll_events_batch");
 
-    if handle.is_null() || channel_id.is_null() || text.is_null() || root_id.is_null() {
+    if handle.is_null() || out_events.is_null() || out_count.is_null() {
         error::set_last_error(Error::null_pointer());
-        return std::ptr::null_mut();
+        return ErrorCode::NullPointer;
     }
 
-    let channel_id_str = {
-        match std::ffi::CStr::from_ptr(channel_id).to_str() {
-            Ok(s) => s,
-            Err(_) => {
-                error::set_last_error(Error::invalid_utf8());
-                return std::ptr::null_mut();
-            }
-        }
-    };
+    *out_events = std::ptr::null_mut();
+    *out_count = 0;
 
-    let text_str = {
-        match std::ffi::CStr::from_ptr(text).to_str() {
-            Ok(s) => s,
-            Err(_) => {
-                error::set_last_error(Error::invalid_utf8());
-                return std::ptr::null_mut();
+    if max_events == 0 {
+        return ErrorCode::Success;
+    }
+
+    let platform = &mut **handle;
+
+    // Drain the queue with a single runtime entry instead of one per event
+    let result = runtime::block_on(async {
+        let mut events = Vec::new();
+        while events.len() < max_events {
+            match platform.poll_event().await {
+                Ok(Some(event)) => events.push(event),
+                Ok(None) => break,
+                Err(e) => return Err(e),
             }
         }
-    };
+        Ok(events)
+    });
 
-    let root_id_str = {
-        match std::ffi::CStr::from_ptr(root_id).to_str() {
-            Ok(s) => s,
-            Err(_) => {
-                error::set_last_error(Error::invalid_utf8());
-                return std::ptr::null_mut();
-            }
+    let events = match result {
+        Ok(events) => events,
+        Err(e) => {
+            let code = e.code;
+            error::set_last_error(e);
+            return code;
         }
     };
 
-    let platform = &**handle;
-
-    match runtime::block_on(platform.send_reply(channel_id_str, text_str, root_id_str)) {
-        Ok(message) => match serde_json::to_string(&message) {
-            Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
-                Err(_) => {
-                    error::set_last_error(Error::new(
-                        ErrorCode::OutOfMemory,
-                        "Failed to allocate string",
-                    ));
-                    std::ptr::null_mut()
+    if events.is_empty() {
+        return ErrorCode::Success;
+    }
+
+    let mut strings: Vec<*mut c_char> = Vec::with_capacity(events.len());
+    for event in events {
+        let json = platform_event_to_json(event);
+        let c_string = serde_json::to_string(&json)
+            .ok()
+            .and_then(|s| CString::new(s).ok());
+        match c_string {
+            Some(c_string) => strings.push(c_string.into_raw()),
+            None => {
+                // Free everything allocated so far before reporting the failure
+                for s in strings {
+                    let _ = CString::from_raw(s);
                 }
-            },
-            Err(e) => {
                 error::set_last_error(Error::new(
-                    ErrorCode::Unknown,
-                    format!("Failed to serialize message: {e}"),
+                    ErrorCode::OutOfMemory,
+                    "Failed to allocate event string",
                 ));
-                std::ptr::null_mut()
+                return ErrorCode::OutOfMemory;
             }
-        },
-        Err(e) => {
-            error::set_last_error(e);
-            std::ptr::null_mut()
         }
     }
+
+    *out_count = strings.len();
+    *out_events = Box::into_raw(strings.into_boxed_slice()) as *mut *mut c_char;
+    ErrorCode::Success
 }
 
-/// FFI function: Update/edit a message
-/// Returns a JSON string representing the updated Message
-/// The caller must free the returned string using communicator_free_string()
-/// Returns NULL on error
+/// FFI function: Free an event array returned by communicator_platform_poll_events_batch
+/// Frees each event string and the array itself in one call
 #[no_mangle]
 ///
 /// # Safety
 /// This function is unsafe because it deals with raw pointers from C.
-/// The caller must ensure all pointer arguments are valid.
-pub unsafe extern "C" fn communicator_platform_update_message(
+/// The caller must ensure events and count match a previous batch poll result.
+pub unsafe extern "C" fn communicator_free_event_batch(events: *mut *mut c_char, count: usize) {
+    if events.is_null() {
+        return;
+    }
+
+    let slice = std::ptr::slice_from_raw_parts_mut(events, count);
+    let boxed = Box::from_raw(slice);
+    for s in boxed.iter() {
+        if !s.is_null() {
+            let _ = CString::from_raw(*s);
+        }
+    }
+}
+
+/// Callback function type for push-mode event delivery
+/// Parameters: event_json, user_data
+pub type PlatformEventCallback = extern "C" fn(*const c_char, *mut c_void);
+
+/// Wrapper so an opaque C user_data pointer can be captured by the callback
+/// closure, which runs on the library's runtime threads. The C side is
+/// responsible for any synchronization the pointed-to data needs.
+struct SendPtr(*mut c_void);
+unsafe impl Send for SendPtr {}
+unsafe impl Sync for SendPtr {}
+
+/// FFI function: Register a callback for push-mode event delivery
+/// When a callback is registered, events are delivered directly from the
+/// WebSocket reader task instead of being queued for polling. The callback
+/// runs on the library's internal runtime threads, so it must be cheap and
+/// must not block; the event_json pointer is only valid for the duration of
+/// the call. Pass NULL as the callback to clear it and return to poll mode.
+/// Returns ErrorCode indicating success or failure
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure the handle is valid and that user_data remains
+/// valid until the callback is cleared or the platform is destroyed.
+pub unsafe extern "C" fn communicator_platform_set_event_callback(
     handle: PlatformHandle,
-    message_id: *const c_char,
-    new_text: *const c_char,
-) -> *mut c_char {
+    callback: Option<PlatformEventCallback>,
+    user_data: *mut c_void,
+) -> ErrorCode {
     error::clear_last_error();
 
-    if handle.is_null() || message_id.is_null() || new_text.is_null() {
+    if handle.is_null() {
         error::set_last_error(Error::null_pointer());
-        return std::ptr::null_mut();
+        return ErrorCode::NullPointer;
     }
 
-    let message_id_str = {
-        match std::ffi::CStr::from_ptr(message_id).to_str() {
-            Ok(s) => s,
-            Err(_) => {
-                error::set_last_error(Error::invalid_utf8());
-                return std::ptr::null_mut();
-            }
-        }
-    };
-
-    let text_str = {
-        match std::ffi::CStr::from_ptr(new_text).to_str() {
-            Ok(s) => s,
-            Err(_) => {
-                error::set_last_error(Error::invalid_utf8());
-                return std::ptr::null_mut();
-            }
-        }
-    };
-
-    let platform = &**handle;
+    let platform = &mut **handle;
 
-    match runtime::block_on(platform.update_message(message_id_str, text_str)) {
-        Ok(message) => match serde_json::to_string(&message) {
-            Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
-                Err(_) => {
-                    error::set_last_error(Error::new(
-                        ErrorCode::OutOfMemory,
-                        "Failed to allocate string",
-                    ));
-                    std::ptr::null_mut()
-                }
-            },
-            Err(e) => {
-                error::set_last_error(Error::new(
-                    ErrorCode::Unknown,
-                    format!("Failed to serialize message: {e}"),
-                ));
-                std::ptr::null_mut()
-            }
-        },
+    let rust_callback = callback.map(|callback| {
+        let user_data = SendPtr(user_data);
+        let callback: platforms::EventCallback = std::sync::Arc::new(move |event| {
+            // Reference the wrapper itself so the closure captures SendPtr,
+            // not the raw pointer field (edition 2021 disjoint capture)
+            let user_data = &user_data;
+            let json = platform_event_to_json(event);
+            if let Some(c_string) = serde_json::to_string(&json)
+                .ok()
+                .and_then(|s| CString::new(s).ok())
+            {
+                callback(c_string.as_ptr(), user_data.0);
+            }
+        });
+        callback
+    });
+
+    let result = runtime::block_on(platform.set_event_callback(rust_callback));
+
+    match result {
+        Ok(()) => ErrorCode::Success,
         Err(e) => {
+            let code = e.code;
             error::set_last_error(e);
-            std::ptr::null_mut()
+            code
         }
     }
 }
 
-/// FFI function: Delete a message
+/// FFI function: Set a subscription filter for incoming events
+/// Both arguments are JSON arrays of strings, e.g. ["posted","typing"].
+/// types_json holds platform-native event type names to accept;
+/// channel_ids_json holds channel IDs to accept. Pass NULL (or an empty
+/// array) for either to accept everything on that dimension; pass NULL for
+/// both to clear the filter. Filtered events are dropped before full
+/// deserialization and never occupy the event queue, which keeps heavy
+/// streams (typing, status changes) cheap when they are not consumed.
+/// Events without a channel always pass the channel filter.
 /// Returns ErrorCode indicating success or failure
 #[no_mangle]
 ///
 /// # Safety
 /// This function is unsafe because it deals with raw pointers from C.
 /// The caller must ensure all pointer arguments are valid.
-pub unsafe extern "C" fn communicator_platform_delete_message(
+pub unsafe extern "C" fn communicator_platform_set_event_filter(
     handle: PlatformHandle,
-    message_id: *const c_char,
+    types_json: *const c_char,
+    channel_ids_json: *const c_char,
+) -> ErrorCode {
+    error::clear_last_error();
+
+    if handle.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return ErrorCode::NullPointer;
+    }
+
+    let parse_string_array =
+        |ptr: *const c_char| -> std::result::Result<Option<Vec<String>>, ErrorCode> {
+            if ptr.is_null() {
+                return Ok(None);
+            }
+            let s = match std::ffi::CStr::from_ptr(ptr).to_str() {
+                Ok(s) => s,
+                Err(_) => {
+                    error::set_last_error(Error::invalid_utf8());
+                    return Err(ErrorCode::InvalidUtf8);
+                }
+            };
+            match serde_json::from_str::<Vec<String>>(s) {
+                Ok(values) => Ok(Some(values)),
+                Err(e) => {
+                    error::set_last_error(Error::new(
+                        ErrorCode::InvalidArgument,
+                        format!("Expected a JSON array of strings: {e}"),
+                    ));
+                    Err(ErrorCode::InvalidArgument)
+                }
+            }
+        };
+
+    let event_types = match parse_string_array(types_json) {
+        Ok(v) => v,
+        Err(code) => return code,
+    };
+    let channel_ids = match parse_string_array(channel_ids_json) {
+        Ok(v) => v,
+        Err(code) => return code,
+    };
+
+    let platform = &mut **handle;
+
+    match runtime::block_on(platform.set_event_filter(event_types, channel_ids)) {
+        Ok(()) => ErrorCode::Success,
+        Err(e) => {
+            let code = e.code;
+            error::set_last_error(e);
+            code
+        }
+    }
+}
+
+/// FFI function: Set the policy applied when the event queue overflows
+/// policy selects the behavior: 0 drops the incoming event (default),
+/// 1 evicts the oldest queued event to make room, 2 blocks the reader
+/// task for up to timeout_ms milliseconds before dropping the incoming
+/// event. timeout_ms is only used when policy is 2. Dropped events are
+/// counted per event type in the metrics returned by
+/// communicator_platform_get_metrics, alongside the current queue depth.
+/// Returns ErrorCode indicating success or failure
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure the handle is valid.
+pub unsafe extern "C" fn communicator_platform_set_queue_overflow_policy(
+    handle: PlatformHandle,
+    policy: c_int,
+    timeout_ms: u64,
+) -> ErrorCode {
+    error::clear_last_error();
+
+    if handle.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return ErrorCode::NullPointer;
+    }
+
+    let policy = match policy {
+        0 => platforms::OverflowPolicy::DropNewest,
+        1 => platforms::OverflowPolicy::DropOldest,
+        2 => platforms::OverflowPolicy::BlockWithTimeout(std::time::Duration::from_millis(
+            timeout_ms,
+        )),
+        other => {
+            error::set_last_error(Error::new(
+                ErrorCode::InvalidArgument,
+                format!("Unknown overflow policy: {other}"),
+            ));
+            return ErrorCode::InvalidArgument;
+        }
+    };
+
+    let platform = &mut **handle;
+
+    match runtime::block_on(platform.set_queue_overflow_policy(policy)) {
+        Ok(()) => ErrorCode::Success,
+        Err(e) => {
+            let code = e.code;
+            error::set_last_error(e);
+            code
+        }
+    }
+}
+
+// ============================================================================
+// Async Send Operations
+// ============================================================================
+
+/// Callback function type for async send completion
+/// Parameters: request_id, message_json (NULL on failure), error_code, user_data
+pub type SendCompletionCallback = extern "C" fn(u64, *const c_char, ErrorCode, *mut c_void);
+
+/// Wrapper so a platform handle can be captured by a spawned task.
+/// The C side must keep the handle alive until all in-flight async
+/// requests have completed.
+struct RawPlatform(PlatformHandle);
+unsafe impl Send for RawPlatform {}
+unsafe impl Sync for RawPlatform {}
+
+lazy_static::lazy_static! {
+    /// Limits how many async sends run concurrently on the runtime.
+    /// Replaced wholesale when the limit changes; in-flight requests
+    /// holding permits on the old semaphore are unaffected.
+    static ref ASYNC_SEND_LIMITER: std::sync::Mutex<std::sync::Arc<tokio::sync::Semaphore>> =
+        std::sync::Mutex::new(std::sync::Arc::new(tokio::sync::Semaphore::new(
+            DEFAULT_ASYNC_SEND_LIMIT,
+        )));
+}
+
+/// Monotonically increasing id handed back from async send calls
+static NEXT_REQUEST_ID: std::sync::atomic::AtomicU64 = std::sync::atomic::AtomicU64::new(1);
+
+/// Default maximum number of concurrent async sends
+const DEFAULT_ASYNC_SEND_LIMIT: usize = 16;
+
+fn async_send_limiter() -> std::sync::Arc<tokio::sync::Semaphore> {
+    ASYNC_SEND_LIMITER
+        .lock()
+        .map(|guard| std::sync::Arc::clone(&guard))
+        .unwrap_or_else(|_| std::sync::Arc::new(tokio::sync::Semaphore::new(1)))
+}
+
+/// Invoke the completion callback with the outcome of an async send
+fn deliver_send_result(
+    callback: SendCompletionCallback,
+    request_id: u64,
+    user_data: &SendPtr,
+    result: Result<Message>,
+) {
+    match result.and_then(|message| {
+        serde_json::to_string(&message).map_err(|e| {
+            Error::new(
+                ErrorCode::Unknown,
+                format!("Failed to serialize message: {e}"),
+            )
+        })
+    }) {
+        Ok(json) => match CString::new(json) {
+            Ok(c_string) => callback(
+                request_id,
+                c_string.as_ptr(),
+                ErrorCode::Success,
+                user_data.0,
+            ),
+            Err(_) => callback(
+                request_id,
+                std::ptr::null(),
+                ErrorCode::OutOfMemory,
+                user_data.0,
+            ),
+        },
+        Err(e) => callback(request_id, std::ptr::null(), e.code, user_data.0),
+    }
+}
+
+/// FFI function: Set the maximum number of concurrent async send requests
+/// Applies to requests started after this call; defaults to 16.
+/// Returns ErrorCode indicating success or failure
+#[no_mangle]
+pub extern "C" fn communicator_set_async_send_limit(limit: usize) -> ErrorCode {
+    error::clear_last_error();
+
+    if limit == 0 {
+        error::set_last_error(Error::new(
+            ErrorCode::InvalidArgument,
+            "Async send limit must be greater than zero",
+        ));
+        return ErrorCode::InvalidArgument;
+    }
+
+    match ASYNC_SEND_LIMITER.lock() {
+        Ok(mut guard) => {
+            *guard = std::sync::Arc::new(tokio::sync::Semaphore::new(limit));
+            ErrorCode::Success
+        }
+        Err(_) => {
+            error::set_last_error(Error::new(
+                ErrorCode::Unknown,
+                "Failed to acquire async send limiter lock",
+            ));
+            ErrorCode::Unknown
+        }
+    }
+}
+
+/// FFI function: Send a message without blocking the calling thread
+/// The request executes concurrently on the internal runtime, bounded by the
+/// async send limit, and the callback is invoked exactly once on a runtime
+/// thread with the result. The message_json pointer passed to the callback is
+/// only valid for the duration of the call.
+/// Returns the request id (> 0), or 0 on immediate failure
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid and that the
+/// platform handle and user_data remain valid until the callback fires.
+pub unsafe extern "C" fn communicator_platform_send_message_async(
+    handle: PlatformHandle,
+    channel_id: *const c_char,
+    text: *const c_char,
+    callback: SendCompletionCallback,
+    user_data: *mut c_void,
+) -> u64 {
+    error::clear_last_error();
+
+    if handle.is_null() || channel_id.is_null() || text.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return 0;
+    }
+
+    let channel_id_str = {
+        match std::ffi::CStr::from_ptr(channel_id).to_str() {
+            Ok(s) => s.to_string(),
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return 0;
+            }
+        }
+    };
+
+    let text_str = {
+        match std::ffi::CStr::from_ptr(text).to_str() {
+            Ok(s) => s.to_string(),
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return 0;
+            }
+        }
+    };
+
+    let request_id = NEXT_REQUEST_ID.fetch_add(1, std::sync::atomic::Ordering::Relaxed);
+    let raw = RawPlatform(handle);
+    let user_data = SendPtr(user_data);
+    let limiter = async_send_limiter();
+
+    let spawned = runtime::spawn(async move {
+        let _permit = limiter.acquire_owned().await.ok();
+        // Reference the wrapper itself so the task captures RawPlatform,
+        // not the raw pointer field (edition 2021 disjoint capture)
+        let raw = &raw;
+        let platform = unsafe { &**raw.0 };
+        let result = platform.send_message(&channel_id_str, &text_str).await;
+        deliver_send_result(callback, request_id, &user_data, result);
+    });
+
+    if spawned.is_none() {
+        error::set_last_error(Error::new(
+            ErrorCode::InvalidState,
+            "Runtime not initialized - call communicator_init first",
+        ));
+        return 0;
+    }
+
+    request_id
+}
+
+/// FFI function: Send a threaded reply without blocking the calling thread
+/// Async variant of communicator_platform_send_reply; see
+/// communicator_platform_send_message_async for callback semantics.
+/// Returns the request id (> 0), or 0 on immediate failure
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid and that the
+/// platform handle and user_data remain valid until the callback fires.
+pub unsafe extern "C" fn communicator_platform_send_reply_async(
+    handle: PlatformHandle,
+    channel_id: *const c_char,
+    text: *const c_char,
+    root_id: *const c_char,
+    callback: SendCompletionCallback,
+    user_data: *mut c_void,
+) -> u64 {
+    error::clear_last_error();
+
+    if handle.is_null() || channel_id.is_null() || text.is_null() || root_id.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return 0;
+    }
+
+    let channel_id_str = {
+        match std::ffi::CStr::from_ptr(channel_id).to_str() {
+            Ok(s) => s.to_string(),
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return 0;
+            }
+        }
+    };
+
+    let text_str = {
+        match std::ffi::CStr::from_ptr(text).to_str() {
+            Ok(s) => s.to_string(),
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return 0;
+            }
+        }
+    };
+
+    let root_id_str = {
+        match std::ffi::CStr::from_ptr(root_id).to_str() {
+            Ok(s) => s.to_string(),
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return 0;
+            }
+        }
+    };
+
+    let request_id = NEXT_REQUEST_ID.fetch_add(1, std::sync::atomic::Ordering::Relaxed);
+    let raw = RawPlatform(handle);
+    let user_data = SendPtr(user_data);
+    let limiter = async_send_limiter();
+
+    let spawned = runtime::spawn(async move {
+        let _permit = limiter.acquire_owned().await.ok();
+        // Reference the wrapper itself so the task captures RawPlatform,
+        // not the raw pointer field (edition 2021 disjoint capture)
+        let raw = &raw;
+        let platform = unsafe { &**raw.0 };
+        let result = platform
+            .send_reply(&channel_id_str, &text_str, &root_id_str)
+            .await;
+        deliver_send_result(callback, request_id, &user_data, result);
+    });
+
+    if spawned.is_none() {
+        error::set_last_error(Error::new(
+            ErrorCode::InvalidState,
+            "Runtime not initialized - call communicator_init first",
+        ));
+        return 0;
+    }
+
+    request_id
+}
+
+/// Callback function type for terminal outbound queue failures
+/// Parameters: channel_id, message text, error_code, user_data
+pub type SendFailureCallback = extern "C" fn(*const c_char, *const c_char, ErrorCode, *mut c_void);
+
+/// FFI function: Enqueue a message for background delivery
+/// Returns as soon as the message is queued; a background task on the
+/// runtime delivers it with per-channel ordering, retrying transient
+/// failures (network errors, rate limiting, timeouts) with exponential
+/// backoff. Messages that exhaust their retries are reported through the
+/// callback registered with communicator_platform_set_callback_send_failure
+/// and dropped. Fails with InvalidState when the channel's queue is full.
+/// Returns ErrorCode indicating success or failure
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid.
+pub unsafe extern "C" fn communicator_platform_enqueue_message(
+    handle: PlatformHandle,
+    channel_id: *const c_char,
+    text: *const c_char,
+) -> ErrorCode {
+    error::clear_last_error();
+    let _timer = metrics::timer("enqueue_message");
+
+    if handle.is_null() || channel_id.is_null() || text.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return ErrorCode::NullPointer;
+    }
+
+    let channel_id_str = {
+        match std::ffi::CStr::from_ptr(channel_id).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return ErrorCode::InvalidUtf8;
+            }
+        }
+    };
+
+    let text_str = {
+        match std::ffi::CStr::from_ptr(text).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return ErrorCode::InvalidUtf8;
+            }
+        }
+    };
+
+    let platform = &**handle;
+
+    match runtime::block_on(platform.enqueue_message(channel_id_str, text_str)) {
+        Ok(()) => ErrorCode::Success,
+        Err(e) => {
+            let code = e.code;
+            error::set_last_error(e);
+            code
+        }
+    }
+}
+
+/// FFI function: Register a callback for terminal outbound queue failures
+/// The callback runs on the library's internal runtime threads after an
+/// enqueued message has exhausted its retries; the string pointers are
+/// only valid for the duration of the call. Pass NULL as the callback to
+/// clear it.
+/// Returns ErrorCode indicating success or failure
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure the handle is valid and that user_data remains
+/// valid until the callback is cleared or the platform is destroyed.
+pub unsafe extern "C" fn communicator_platform_set_callback_send_failure(
+    handle: PlatformHandle,
+    callback: Option<SendFailureCallback>,
+    user_data: *mut c_void,
+) -> ErrorCode {
+    error::clear_last_error();
+
+    if handle.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return ErrorCode::NullPointer;
+    }
+
+    let platform = &mut **handle;
+
+    let rust_callback = callback.map(|callback| {
+        let user_data = SendPtr(user_data);
+        let rust_callback: platforms::SendFailureCallback =
+            std::sync::Arc::new(move |channel_id: &str, text: &str, error: &Error| {
+                // Reference the wrapper itself so the closure captures
+                // SendPtr, not the raw pointer field (edition 2021
+                // disjoint capture)
+                let user_data = &user_data;
+                if let (Ok(c_channel), Ok(c_text)) = (CString::new(channel_id), CString::new(text))
+                {
+                    callback(c_channel.as_ptr(), c_text.as_ptr(), error.code, user_data.0);
+                }
+            });
+        rust_callback
+    });
+
+    match runtime::block_on(platform.set_send_failure_callback(rust_callback)) {
+        Ok(()) => ErrorCode::Success,
+        Err(e) => {
+            let code = e.code;
+            error::set_last_error(e);
+            code
+        }
+    }
+}
+
+// ============================================================================
+// Typed Struct API
+// ============================================================================
+// Parallel to the JSON-string API: hot read paths can fetch fixed-field C
+// structs populated directly from the Rust types, skipping serialization and
+// re-parsing entirely. Variable or platform-specific data (attachments,
+// metadata) stays on the JSON API.
+
+/// Channel type constants for the typed struct API
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum CommunicatorChannelType {
+    /// Public channel (anyone can join)
+    Public = 0,
+    /// Private channel (invite-only)
+    Private = 1,
+    /// Direct message between two users
+    DirectMessage = 2,
+    /// Group direct message (multiple users)
+    GroupMessage = 3,
+}
+
+/// User status constants for the typed struct API
+#[repr(C)]
+#[derive(Debug, Clone, Copy, PartialEq, Eq)]
+pub enum CommunicatorUserStatus {
+    /// User is online and active
+    Online = 0,
+    /// User is away/idle
+    Away = 1,
+    /// User is in "do not disturb" mode
+    DoNotDisturb = 2,
+    /// User is offline
+    Offline = 3,
+    /// Status is unknown
+    Unknown = 4,
+}
+
+/// C-compatible message with fixed fields
+/// All string fields are owned by the containing list and freed with it
+#[repr(C)]
+pub struct CommunicatorMessage {
+    /// Unique identifier for this message
+    pub id: *mut c_char,
+    /// The message text/content
+    pub text: *mut c_char,
+    /// User ID of the sender
+    pub sender_id: *mut c_char,
+    /// Channel ID where this message was sent
+    pub channel_id: *mut c_char,
+    /// When the message was created (Unix milliseconds)
+    pub created_at: i64,
+    /// When the message was last edited (Unix milliseconds, 0 if never)
+    pub edited_at: i64,
+    /// Number of attachments on the message (fetch details via the JSON API)
+    pub attachment_count: usize,
+}
+
+/// C-compatible channel with fixed fields
+/// Optional string fields are NULL when absent
+#[repr(C)]
+pub struct CommunicatorChannel {
+    /// Unique identifier for this channel
+    pub id: *mut c_char,
+    /// Channel name
+    pub name: *mut c_char,
+    /// Human-readable display name
+    pub display_name: *mut c_char,
+    /// Optional channel topic (NULL if unset)
+    pub topic: *mut c_char,
+    /// Optional channel purpose (NULL if unset)
+    pub purpose: *mut c_char,
+    /// Type of channel
+    pub channel_type: CommunicatorChannelType,
+    /// When the channel was created (Unix milliseconds)
+    pub created_at: i64,
+    /// Last activity timestamp (Unix milliseconds, 0 if unknown)
+    pub last_activity_at: i64,
+    /// Whether the channel is archived (0 or 1)
+    pub is_archived: i32,
+}
+
+/// C-compatible user with fixed fields
+/// Optional string fields are NULL when absent
+#[repr(C)]
+pub struct CommunicatorUser {
+    /// Unique identifier for this user
+    pub id: *mut c_char,
+    /// Username (unique login name)
+    pub username: *mut c_char,
+    /// Display name (what other users see)
+    pub display_name: *mut c_char,
+    /// Email address (NULL if unavailable)
+    pub email: *mut c_char,
+    /// Avatar URL (NULL if unavailable)
+    pub avatar_url: *mut c_char,
+    /// Custom status message (NULL if unset)
+    pub status_message: *mut c_char,
+    /// Current presence status
+    pub status: CommunicatorUserStatus,
+    /// Whether this user is a bot (0 or 1)
+    pub is_bot: i32,
+}
+
+/// Array container for typed messages
+#[repr(C)]
+pub struct CommunicatorMessageList {
+    /// Array of messages (NULL when count is 0)
+    pub items: *mut CommunicatorMessage,
+    /// Number of messages in the array
+    pub count: usize,
+}
+
+/// Array container for typed channels
+#[repr(C)]
+pub struct CommunicatorChannelList {
+    /// Array of channels (NULL when count is 0)
+    pub items: *mut CommunicatorChannel,
+    /// Number of channels in the array
+    pub count: usize,
+}
+
+/// Array container for typed users
+#[repr(C)]
+pub struct CommunicatorUserList {
+    /// Array of users (NULL when count is 0)
+    pub items: *mut CommunicatorUser,
+    /// Number of users in the array
+    pub count: usize,
+}
+
+/// Convert an owned string into a C string pointer
+/// Interior NUL bytes are stripped rather than failing the whole call
+fn owned_c_string(s: String) -> *mut c_char {
+    CString::new(s)
+        .unwrap_or_else(|e| {
+            let mut bytes = e.into_vec();
+            bytes.retain(|&b| b != 0);
+            CString::new(bytes).unwrap_or_default()
+        })
+        .into_raw()
+}
+
+/// Convert an optional owned string into a C string pointer (NULL for None)
+fn optional_c_string(s: Option<String>) -> *mut c_char {
+    match s {
+        Some(s) => owned_c_string(s),
+        None => std::ptr::null_mut(),
+    }
+}
+
+/// Free a string field of a typed struct (NULL-safe)
+unsafe fn free_c_string_field(s: *mut c_char) {
+    if !s.is_null() {
+        let _ = CString::from_raw(s);
+    }
+}
+
+impl From<Message> for CommunicatorMessage {
+    fn from(message: Message) -> Self {
+        CommunicatorMessage {
+            id: owned_c_string(message.id),
+            text: owned_c_string(message.text),
+            sender_id: owned_c_string(message.sender_id),
+            channel_id: owned_c_string(message.channel_id),
+            created_at: message.created_at.timestamp_millis(),
+            edited_at: message.edited_at.map(|t| t.timestamp_millis()).unwrap_or(0),
+            attachment_count: message.attachments.len(),
+        }
+    }
+}
+
+impl From<Channel> for CommunicatorChannel {
+    fn from(channel: Channel) -> Self {
+        CommunicatorChannel {
+            id: owned_c_string(channel.id),
+            name: owned_c_string(channel.name),
+            display_name: owned_c_string(channel.display_name),
+            topic: optional_c_string(channel.topic),
+            purpose: optional_c_string(channel.purpose),
+            channel_type: match channel.channel_type {
+                ChannelType::Public => CommunicatorChannelType::Public,
+                ChannelType::Private => CommunicatorChannelType::Private,
+                ChannelType::DirectMessage => CommunicatorChannelType::DirectMessage,
+                ChannelType::GroupMessage => CommunicatorChannelType::GroupMessage,
+            },
+            created_at: channel.created_at.timestamp_millis(),
+            last_activity_at: channel
+                .last_activity_at
+                .map(|t| t.timestamp_millis())
+                .unwrap_or(0),
+            is_archived: channel.is_archived as i32,
+        }
+    }
+}
+
+impl From<User> for CommunicatorUser {
+    fn from(user: User) -> Self {
+        CommunicatorUser {
+            id: owned_c_string(user.id),
+            username: owned_c_string(user.username),
+            display_name: owned_c_string(user.display_name),
+            email: optional_c_string(user.email),
+            avatar_url: optional_c_string(user.avatar_url),
+            status_message: optional_c_string(user.status_message),
+            status: match user.status {
+                types::user::UserStatus::Online => CommunicatorUserStatus::Online,
+                types::user::UserStatus::Away => CommunicatorUserStatus::Away,
+                types::user::UserStatus::DoNotDisturb => CommunicatorUserStatus::DoNotDisturb,
+                types::user::UserStatus::Offline => CommunicatorUserStatus::Offline,
+                types::user::UserStatus::Unknown => CommunicatorUserStatus::Unknown,
+            },
+            is_bot: user.is_bot as i32,
+        }
+    }
+}
+
+/// Turn a Vec of converted structs into an (items, count) pair for a list
+fn into_c_array<T>(items: Vec<T>) -> (*mut T, usize) {
+    if items.is_empty() {
+        return (std::ptr::null_mut(), 0);
+    }
+    let count = items.len();
+    let boxed = items.into_boxed_slice();
+    (Box::into_raw(boxed) as *mut T, count)
+}
+
+/// FFI function: Get recent messages from a channel as typed structs
+/// Typed variant of communicator_platform_get_messages that skips JSON
+/// serialization; attachment details are only available via the JSON API.
+/// The list must be freed with communicator_free_message_list().
+/// Returns ErrorCode indicating success or failure
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid.
+pub unsafe extern "C" fn communicator_platform_get_messages_typed(
+    handle: PlatformHandle,
+    channel_id: *const c_char,
+    limit: usize,
+    out_list: *mut CommunicatorMessageList,
+) -> ErrorCode {
+    error::clear_last_error();
+
+    if handle.is_null() || channel_id.is_null() || out_list.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return ErrorCode::NullPointer;
+    }
+
+    (*out_list).items = std::ptr::null_mut();
+    (*out_list).count = 0;
+
+    let channel_id_str = {
+        match std::ffi::CStr::from_ptr(channel_id).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return ErrorCode::InvalidUtf8;
+            }
+        }
+    };
+
+    let platform = &**handle;
+
+    match runtime::block_on(platform.get_messages(channel_id_str, limit)) {
+        Ok(messages) => {
+            let converted: Vec<CommunicatorMessage> =
+                messages.into_iter().map(|m| m.into()).collect();
+            let (items, count) = into_c_array(converted);
+            (*out_list).items = items;
+            (*out_list).count = count;
+            ErrorCode::Success
+        }
+        Err(e) => {
+            let code = e.code;
+            error::set_last_error(e);
+            code
+        }
+    }
+}
+
+/// FFI function: Get all channels for the current user as typed structs
+/// Typed variant of communicator_platform_get_channels that skips JSON
+/// serialization.
+/// The list must be freed with communicator_free_channel_list().
+/// Returns ErrorCode indicating success or failure
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid.
+pub unsafe extern "C" fn communicator_platform_get_channels_typed(
+    handle: PlatformHandle,
+    out_list: *mut CommunicatorChannelList,
+) -> ErrorCode {
+    error::clear_last_error();
+
+    if handle.is_null() || out_list.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return ErrorCode::NullPointer;
+    }
+
+    (*out_list).items = std::ptr::null_mut();
+    (*out_list).count = 0;
+
+    let platform = &**handle;
+
+    match runtime::block_on(platform.get_channels()) {
+        Ok(channels) => {
+            let converted: Vec<CommunicatorChannel> =
+                channels.into_iter().map(|c| c.into()).collect();
+            let (items, count) = into_c_array(converted);
+            (*out_list).items = items;
+            (*out_list).count = count;
+            ErrorCode::Success
+        }
+        Err(e) => {
+            let code = e.code;
+            error::set_last_error(e);
+            code
+        }
+    }
+}
+
+/// FFI function: Get members of a channel as typed structs
+/// Typed variant of communicator_platform_get_channel_members that skips
+/// JSON serialization.
+/// The list must be freed with communicator_free_user_list().
+/// Returns ErrorCode indicating success or failure
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid.
+pub unsafe extern "C" fn communicator_platform_get_channel_members_typed(
+    handle: PlatformHandle,
+    channel_id: *const c_char,
+    out_list: *mut CommunicatorUserList,
+) -> ErrorCode {
+    error::clear_last_error();
+
+    if handle.is_null() || channel_id.is_null() || out_list.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return ErrorCode::NullPointer;
+    }
+
+    (*out_list).items = std::ptr::null_mut();
+    (*out_list).count = 0;
+
+    let channel_id_str = {
+        match std::ffi::CStr::from_ptr(channel_id).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return ErrorCode::InvalidUtf8;
+            }
+        }
+    };
+
+    let platform = &**handle;
+
+    match runtime::block_on(platform.get_channel_members(channel_id_str)) {
+        Ok(users) => {
+            let converted: Vec<CommunicatorUser> = users.into_iter().map(|u| u.into()).collect();
+            let (items, count) = into_c_array(converted);
+            (*out_list).items = items;
+            (*out_list).count = count;
+            ErrorCode::Success
+        }
+        Err(e) => {
+            let code = e.code;
+            error::set_last_error(e);
+            code
+        }
+    }
+}
+
+/// FFI function: Free a message list returned by the typed API
+/// Frees every string field, the array, and resets the list to empty
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure the list came from a typed getter and is freed once.
+pub unsafe extern "C" fn communicator_free_message_list(list: *mut CommunicatorMessageList) {
+    if list.is_null() {
+        return;
+    }
+
+    let list = &mut *list;
+    if !list.items.is_null() {
+        let items = Box::from_raw(std::ptr::slice_from_raw_parts_mut(list.items, list.count));
+        for item in items.iter() {
+            free_c_string_field(item.id);
+            free_c_string_field(item.text);
+            free_c_string_field(item.sender_id);
+            free_c_string_field(item.channel_id);
+        }
+    }
+    list.items = std::ptr::null_mut();
+    list.count = 0;
+}
+
+/// FFI function: Free a channel list returned by the typed API
+/// Frees every string field, the array, and resets the list to empty
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure the list came from a typed getter and is freed once.
+pub unsafe extern "C" fn communicator_free_channel_list(list: *mut CommunicatorChannelList) {
+    if list.is_null() {
+        return;
+    }
+
+    let list = &mut *list;
+    if !list.items.is_null() {
+        let items = Box::from_raw(std::ptr::slice_from_raw_parts_mut(list.items, list.count));
+        for item in items.iter() {
+            free_c_string_field(item.id);
+            free_c_string_field(item.name);
+            free_c_string_field(item.display_name);
+            free_c_string_field(item.topic);
+            free_c_string_field(item.purpose);
+        }
+    }
+    list.items = std::ptr::null_mut();
+    list.count = 0;
+}
+
+/// FFI function: Free a user list returned by the typed API
+/// Frees every string field, the array, and resets the list to empty
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure the list came from a typed getter and is freed once.
+pub unsafe extern "C" fn communicator_free_user_list(list: *mut CommunicatorUserList) {
+    if list.is_null() {
+        return;
+    }
+
+    let list = &mut *list;
+    if !list.items.is_null() {
+        let items = Box::from_raw(std::ptr::slice_from_raw_parts_mut(list.items, list.count));
+        for item in items.iter() {
+            free_c_string_field(item.id);
+            free_c_string_field(item.username);
+            free_c_string_field(item.display_name);
+            free_c_string_field(item.email);
+            free_c_string_field(item.avatar_url);
+            free_c_string_field(item.status_message);
+        }
+    }
+    list.items = std::ptr::null_mut();
+    list.count = 0;
+}
+
+// ============================================================================
+// Cache Snapshots
+// ============================================================================
+
+/// FFI function: Save the platform's cache contents to a snapshot file
+/// Intended to be called during shutdown; the next process start can load the
+/// snapshot and skip the cold-start burst of API calls.
+/// Returns ErrorCode indicating success or failure
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid.
+pub unsafe extern "C" fn communicator_platform_save_cache_snapshot(
+    handle: PlatformHandle,
+    path: *const c_char,
+) -> ErrorCode {
+    error::clear_last_error();
+
+    if handle.is_null() || path.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return ErrorCode::NullPointer;
+    }
+
+    let path_str = {
+        match std::ffi::CStr::from_ptr(path).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return ErrorCode::InvalidUtf8;
+            }
+        }
+    };
+
+    let platform = &**handle;
+
+    match runtime::block_on(platform.save_cache_snapshot(std::path::Path::new(path_str))) {
+        Ok(()) => ErrorCode::Success,
+        Err(e) => {
+            let code = e.code;
+            error::set_last_error(e);
+            code
+        }
+    }
+}
+
+/// FFI function: Load the platform's cache contents from a snapshot file
+/// Call after connecting for a warm start. Loaded entries keep their
+/// remaining TTL and are revalidated lazily against the server as they
+/// expire.
+/// Returns ErrorCode indicating success or failure
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid.
+pub unsafe extern "C" fn communicator_platform_load_cache_snapshot(
+    handle: PlatformHandle,
+    path: *const c_char,
+) -> ErrorCode {
+    error::clear_last_error();
+
+    if handle.is_null() || path.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return ErrorCode::NullPointer;
+    }
+
+    let path_str = {
+        match std::ffi::CStr::from_ptr(path).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return ErrorCode::InvalidUtf8;
+            }
+        }
+    };
+
+    let platform = &**handle;
+
+    match runtime::block_on(platform.load_cache_snapshot(std::path::Path::new(path_str))) {
+        Ok(()) => ErrorCode::Success,
+        Err(e) => {
+            let code = e.code;
+            error::set_last_error(e);
+            code
+        }
+    }
+}
+
+/// FFI function: Get cache statistics as JSON
+/// Returns a JSON string mapping cache names to hit, miss and eviction
+/// counters plus the current and maximum entry counts, e.g.
+/// {"users":{"hits":42,"misses":7,"evictions":0,"entries":35,"max_entries":10000},...}
+/// The caller must free the returned string using communicator_free_string()
+/// Returns NULL on error
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid.
+pub unsafe extern "C" fn communicator_platform_get_cache_stats(
+    handle: PlatformHandle,
+) -> *mut c_char {
+    error::clear_last_error();
+
+    if handle.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return std::ptr::null_mut();
+    }
+
+    let platform = &**handle;
+
+    match runtime::block_on(platform.get_cache_stats()) {
+        Ok(json) => match CString::new(json) {
+            Ok(c_string) => arena::export_c_string(c_string),
+            Err(_) => {
+                error::set_last_error(Error::new(
+                    ErrorCode::OutOfMemory,
+                    "Failed to allocate string",
+                ));
+                std::ptr::null_mut()
+            }
+        },
+        Err(e) => {
+            error::set_last_error(e);
+            std::ptr::null_mut()
+        }
+    }
+}
+
+/// FFI function: Get runtime metrics as JSON
+/// Returns a JSON object with two sections:
+///   "operations": per-FFI-operation call counts and latency histograms
+///     (power-of-two microsecond buckets), collected at the FFI layer
+///   "platform": platform-specific counters (WebSocket reconnects, dropped
+///     events, queue depth high-water mark), or null if the platform does
+///     not expose any
+/// The caller must free the returned string using communicator_free_string()
+/// Returns NULL on error
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid.
+pub unsafe extern "C" fn communicator_platform_get_metrics(handle: PlatformHandle) -> *mut c_char {
+    error::clear_last_error();
+
+    if handle.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return std::ptr::null_mut();
+    }
+
+    let platform = &**handle;
+
+    let platform_metrics = match runtime::block_on(platform.get_metrics()) {
+        Ok(json) => serde_json::from_str(&json).unwrap_or(serde_json::Value::Null),
+        Err(e) if e.code == ErrorCode::Unsupported => serde_json::Value::Null,
+        Err(e) => {
+            error::set_last_error(e);
+            return std::ptr::null_mut();
+        }
+    };
+
+    let combined = serde_json::json!({
+        "operations": metrics::snapshot(),
+        "platform": platform_metrics,
+    });
+
+    match serde_json::to_string(&combined) {
+        Ok(json) => match CString::new(json) {
+            Ok(c_string) => arena::export_c_string(c_string),
+            Err(_) => {
+                error::set_last_error(Error::new(
+                    ErrorCode::OutOfMemory,
+                    "Failed to allocate string",
+                ));
+                std::ptr::null_mut()
+            }
+        },
+        Err(e) => {
+            error::set_last_error(Error::new(
+                ErrorCode::Unknown,
+                format!("Failed to serialize metrics: {e}"),
+            ));
+            std::ptr::null_mut()
+        }
+    }
+}
+
+/// FFI function: Reset all runtime metrics to zero
+/// Clears the per-operation latency histograms and the platform-specific
+/// counters, so subsequent snapshots cover a fresh measurement window
+/// Returns ErrorCode::Success on success
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid.
+pub unsafe extern "C" fn communicator_platform_reset_metrics(handle: PlatformHandle) -> ErrorCode {
+    error::clear_last_error();
+
+    if handle.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return ErrorCode::NullPointer;
+    }
+
+    let platform = &**handle;
+
+    metrics::reset();
+
+    match runtime::block_on(platform.reset_metrics()) {
+        Ok(()) => ErrorCode::Success,
+        // A platform without its own counters is not an error here: the
+        // operation histograms were still reset
+        Err(e) if e.code == ErrorCode::Unsupported => ErrorCode::Success,
+        Err(e) => {
+            let code = e.code;
+            error::set_last_error(e);
+            code
+        }
+    }
+}
+
+// ============================================================================
+// Extended Platform FFI Functions
+// ============================================================================
+
+/// FFI function: Send a reply to a message (threaded conversation)
+/// Returns a JSON string representing the created Message
+/// The caller must free the returned string using communicator_free_string()
+/// Returns NULL on error
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid.
+pub unsafe extern "C" fn communicator_platform_send_reply(
+    handle: PlatformHandle,
+    channel_id: *const c_char,
+    text: *const c_char,
+    root_id: *const c_char,
+) -> *mut c_char {
+    error::clear_last_error();
+    let _timer = metrics::timer("send_reply");
+
+    if handle.is_null() || channel_id.is_null() || text.is_null() || root_id.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return std::ptr::null_mut();
+    }
+
+    let channel_id_str = {
+        match std::ffi::CStr::from_ptr(channel_id).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return std::ptr::null_mut();
+            }
+        }
+    };
+
+    let text_str = {
+        match std::ffi::CStr::from_ptr(text).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return std::ptr::null_mut();
+            }
+        }
+    };
+
+    let root_id_str = {
+        match std::ffi::CStr::from_ptr(root_id).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return std::ptr::null_mut();
+            }
+        }
+    };
+
+    let platform = &**handle;
+
+    match runtime::block_on(platform.send_reply(channel_id_str, text_str, root_id_str)) {
+        Ok(message) => match serde_json::to_string(&message) {
+            Ok(json) => match CString::new(json) {
+                Ok(c_string) => arena::export_c_string(c_string),
+                Err(_) => {
+                    error::set_last_error(Error::new(
+                        ErrorCode::OutOfMemory,
+                        "Failed to allocate string",
+                    ));
+                    std::ptr::null_mut()
+                }
+            },
+            Err(e) => {
+                error::set_last_error(Error::new(
+                    ErrorCode::Unknown,
+                    format!("Failed to serialize message: {e}"),
+                ));
+                std::ptr::null_mut()
+            }
+        },
+        Err(e) => {
+            error::set_last_error(e);
+            std::ptr::null_mut()
+        }
+    }
+}
+
+/// FFI function: Update/edit a message
+/// Returns a JSON string representing the updated Message
+/// The caller must free the returned string using communicator_free_string()
+/// Returns NULL on error
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid.
+pub unsafe extern "C" fn communicator_platform_update_message(
+    handle: PlatformHandle,
+    message_id: *const c_char,
+    new_text: *const c_char,
+) -> *mut c_char {
+    error::clear_last_error();
+
+    if handle.is_null() || message_id.is_null() || new_text.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return std::ptr::null_mut();
+    }
+
+    let message_id_str = {
+        match std::ffi::CStr::from_ptr(message_id).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return std::ptr::null_mut();
+            }
+        }
+    };
+
+    let text_str = {
+        match std::ffi::CStr::from_ptr(new_text).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return std::ptr::null_mut();
+            }
+        }
+    };
+
+    let platform = &**handle;
+
+    match runtime::block_on(platform.update_message(message_id_str, text_str)) {
+        Ok(message) => match serde_json::to_string(&message) {
+            Ok(json) => match CString::new(json) {
+                Ok(c_string) => arena::export_c_string(c_string),
+                Err(_) => {
+                    error::set_last_error(Error::new(
+                        ErrorCode::OutOfMemory,
+                        "Failed to allocate string",
+                    ));
+                    std::ptr::null_mut()
+                }
+            },
+            Err(e) => {
+                error::set_last_error(Error::new(
+                    ErrorCode::Unknown,
+                    format!("Failed to serialize message: {e}"),
+                ));
+                std::ptr::null_mut()
+            }
+        },
+        Err(e) => {
+            error::set_last_error(e);
+            std::ptr::null_mut()
+        }
+    }
+}
+
+/// FFI function: Delete a message
+/// Returns ErrorCode indicating success or failure
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid.
+pub unsafe extern "C" fn communicator_platform_delete_message(
+    handle: PlatformHandle,
+    message_id: *const c_char,
 ) -> ErrorCode {
     error::clear_last_error();
 
@@ -2496,8 +4353,79 @@ pub unsafe extern "C" fn communicator_platform_get_message(
         return std::ptr::null_mut();
     }
 
-    let message_id_str = {
-        match std::ffi::CStr::from_ptr(message_id).to_str() {
+    let message_id_str = {
+        match std::ffi::CStr::from_ptr(message_id).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return std::ptr::null_mut();
+            }
+        }
+    };
+
+    let platform = &**handle;
+
+    match runtime::block_on(platform.get_message(message_id_str)) {
+        Ok(message) => match serde_json::to_string(&message) {
+            Ok(json) => match CString::new(json) {
+                Ok(c_string) => arena::export_c_string(c_string),
+                Err(_) => {
+                    error::set_last_error(Error::new(
+                        ErrorCode::OutOfMemory,
+                        "Failed to allocate string",
+                    ));
+                    std::ptr::null_mut()
+                }
+            },
+            Err(e) => {
+                error::set_last_error(Error::new(
+                    ErrorCode::Unknown,
+                    format!("Failed to serialize message: {e}"),
+                ));
+                std::ptr::null_mut()
+            }
+        },
+        Err(e) => {
+            error::set_last_error(e);
+            std::ptr::null_mut()
+        }
+    }
+}
+
+/// FFI function: Get messages before a specific message (pagination)
+/// Returns a JSON array string of Message objects
+/// The caller must free the returned string using communicator_free_string()
+/// Returns NULL on error
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid.
+pub unsafe extern "C" fn communicator_platform_get_messages_before(
+    handle: PlatformHandle,
+    channel_id: *const c_char,
+    before_id: *const c_char,
+    limit: u32,
+) -> *mut c_char {
+    error::clear_last_error();
+
+    if handle.is_null() || channel_id.is_null() || before_id.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return std::ptr::null_mut();
+    }
+
+    let channel_id_str = {
+        match std::ffi::CStr::from_ptr(channel_id).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return std::ptr::null_mut();
+            }
+        }
+    };
+
+    let before_id_str = {
+        match std::ffi::CStr::from_ptr(before_id).to_str() {
             Ok(s) => s,
             Err(_) => {
                 error::set_last_error(Error::invalid_utf8());
@@ -2508,10 +4436,14 @@ pub unsafe extern "C" fn communicator_platform_get_message(
 
     let platform = &**handle;
 
-    match runtime::block_on(platform.get_message(message_id_str)) {
-        Ok(message) => match serde_json::to_string(&message) {
+    match runtime::block_on(platform.get_messages_before(
+        channel_id_str,
+        before_id_str,
+        limit as usize,
+    )) {
+        Ok(messages) => match serialize_masked(handle as usize, "message", &messages) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -2523,7 +4455,7 @@ pub unsafe extern "C" fn communicator_platform_get_message(
             Err(e) => {
                 error::set_last_error(Error::new(
                     ErrorCode::Unknown,
-                    format!("Failed to serialize message: {e}"),
+                    format!("Failed to serialize messages: {e}"),
                 ));
                 std::ptr::null_mut()
             }
@@ -2535,31 +4467,135 @@ pub unsafe extern "C" fn communicator_platform_get_message(
     }
 }
 
-/// FFI function: Get messages before a specific message (pagination)
-/// Returns a JSON array string of Message objects
-/// The caller must free the returned string using communicator_free_string()
-/// Returns NULL on error
+// ============================================================================
+// Message Cursor (prefetching pagination)
+// ============================================================================
+
+/// A pagination cursor over a channel's message history that prefetches
+/// the following page in the background while the caller consumes the
+/// current one, so the network does not sit idle during page processing.
+///
+/// Created by `communicator_platform_open_message_cursor`; not thread-safe —
+/// a cursor must only be used from one thread at a time.
+pub struct MessageCursor {
+    /// The platform the cursor reads from; must outlive the cursor
+    platform: RawPlatform,
+    channel_id: String,
+    page_size: usize,
+    /// Prefetch of the next page, started before the current page is returned
+    prefetch: Option<tokio::task::JoinHandle<Result<Vec<Message>>>>,
+    exhausted: bool,
+}
+
+/// Opaque handle to a message cursor
+pub type MessageCursorHandle = *mut MessageCursor;
+
+impl MessageCursor {
+    /// Start prefetching the page of messages older than `before_id`
+    ///
+    /// A `before_id` of None fetches the newest page.
+    fn start_prefetch(&mut self, before_id: Option<String>) {
+        let raw = RawPlatform(self.platform.0);
+        let channel_id = self.channel_id.clone();
+        let page_size = self.page_size;
+        self.prefetch = runtime::spawn(async move {
+            // Reference the wrapper itself so the task captures RawPlatform,
+            // not the raw pointer field (edition 2021 disjoint capture)
+            let raw = &raw;
+            let platform = unsafe { &**raw.0 };
+            match before_id {
+                Some(before_id) => {
+                    platform
+                        .get_messages_before(&channel_id, &before_id, page_size)
+                        .await
+                }
+                None => platform.get_messages(&channel_id, page_size).await,
+            }
+        });
+    }
+
+    /// Wait for the in-flight prefetch and start the next one
+    ///
+    /// Returns the next page, or None when the history is exhausted.
+    fn next_page(&mut self) -> Result<Option<Vec<Message>>> {
+        if self.exhausted {
+            return Ok(None);
+        }
+
+        let prefetch = match self.prefetch.take() {
+            Some(handle) => handle,
+            None => {
+                return Err(Error::new(
+                    ErrorCode::InvalidState,
+                    "Runtime not initialized - call communicator_init first",
+                ))
+            }
+        };
+
+        let page = runtime::block_on(async move {
+            prefetch.await.unwrap_or_else(|_| {
+                Err(Error::new(
+                    ErrorCode::Unknown,
+                    "Prefetch task was cancelled",
+                ))
+            })
+        })?;
+
+        if page.is_empty() {
+            self.exhausted = true;
+            return Ok(None);
+        }
+
+        // A short page means we reached the start of the history
+        if page.len() < self.page_size {
+            self.exhausted = true;
+        } else {
+            // Messages come newest-first; the last entry is the oldest and
+            // anchors the next page. Kick its fetch off now so it overlaps
+            // with the caller processing this page.
+            let oldest_id = page[page.len() - 1].id.clone();
+            self.start_prefetch(Some(oldest_id));
+        }
+
+        Ok(Some(page))
+    }
+}
+
+/// FFI function: Open a prefetching cursor over a channel's message history
+/// The cursor walks the history newest-first in pages of page_size and
+/// prefetches the following page in the background while the caller
+/// consumes the current one. The platform handle must stay valid for the
+/// cursor's lifetime, and the cursor must be freed with
+/// communicator_message_cursor_free(). A cursor is not thread-safe.
+/// Returns a cursor handle, or NULL on error
 #[no_mangle]
 ///
 /// # Safety
 /// This function is unsafe because it deals with raw pointers from C.
 /// The caller must ensure all pointer arguments are valid.
-pub unsafe extern "C" fn communicator_platform_get_messages_before(
+pub unsafe extern "C" fn communicator_platform_open_message_cursor(
     handle: PlatformHandle,
     channel_id: *const c_char,
-    before_id: *const c_char,
-    limit: u32,
-) -> *mut c_char {
+    page_size: u32,
+) -> MessageCursorHandle {
     error::clear_last_error();
 
-    if handle.is_null() || channel_id.is_null() || before_id.is_null() {
+    if handle.is_null() || channel_id.is_null() {
         error::set_last_error(Error::null_pointer());
         return std::ptr::null_mut();
     }
 
+    if page_size == 0 {
+        error::set_last_error(Error::new(
+            ErrorCode::InvalidArgument,
+            "page_size must be greater than zero",
+        ));
+        return std::ptr::null_mut();
+    }
+
     let channel_id_str = {
         match std::ffi::CStr::from_ptr(channel_id).to_str() {
-            Ok(s) => s,
+            Ok(s) => s.to_string(),
             Err(_) => {
                 error::set_last_error(Error::invalid_utf8());
                 return std::ptr::null_mut();
@@ -2567,26 +4603,56 @@ pub unsafe extern "C" fn communicator_platform_get_messages_before(
         }
     };
 
-    let before_id_str = {
-        match std::ffi::CStr::from_ptr(before_id).to_str() {
-            Ok(s) => s,
-            Err(_) => {
-                error::set_last_error(Error::invalid_utf8());
-                return std::ptr::null_mut();
-            }
-        }
+    let mut cursor = MessageCursor {
+        platform: RawPlatform(handle),
+        channel_id: channel_id_str,
+        page_size: page_size as usize,
+        prefetch: None,
+        exhausted: false,
     };
 
-    let platform = &**handle;
+    // Start fetching the first page immediately so it is already in flight
+    // when the caller asks for it
+    cursor.start_prefetch(None);
+    if cursor.prefetch.is_none() {
+        error::set_last_error(Error::new(
+            ErrorCode::InvalidState,
+            "Runtime not initialized - call communicator_init first",
+        ));
+        return std::ptr::null_mut();
+    }
 
-    match runtime::block_on(platform.get_messages_before(
-        channel_id_str,
-        before_id_str,
-        limit as usize,
-    )) {
-        Ok(messages) => match serde_json::to_string(&messages) {
+    Box::into_raw(Box::new(cursor))
+}
+
+/// FFI function: Get the next page of messages from a cursor
+/// Returns a JSON array string of Message objects, newest first within the
+/// page. Returns NULL with no error set when the history is exhausted;
+/// check communicator_get_last_error() to distinguish end-of-history from
+/// a failure. The caller must free the returned string using
+/// communicator_free_string()
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure the cursor handle is valid and not used from
+/// multiple threads at once.
+pub unsafe extern "C" fn communicator_message_cursor_next(
+    cursor: MessageCursorHandle,
+) -> *mut c_char {
+    error::clear_last_error();
+
+    if cursor.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return std::ptr::null_mut();
+    }
+
+    let cursor = &mut *cursor;
+
+    match cursor.next_page() {
+        Ok(Some(page)) => match serde_json::to_string(&page) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -2603,6 +4669,8 @@ pub unsafe extern "C" fn communicator_platform_get_messages_before(
                 std::ptr::null_mut()
             }
         },
+        // End of history - NULL with no error set
+        Ok(None) => std::ptr::null_mut(),
         Err(e) => {
             error::set_last_error(e);
             std::ptr::null_mut()
@@ -2610,6 +4678,25 @@ pub unsafe extern "C" fn communicator_platform_get_messages_before(
     }
 }
 
+/// FFI function: Free a message cursor
+/// Any still-running prefetch is aborted. Passing NULL is a no-op.
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure the cursor handle came from
+/// communicator_platform_open_message_cursor and is not used afterwards.
+pub unsafe extern "C" fn communicator_message_cursor_free(cursor: MessageCursorHandle) {
+    if cursor.is_null() {
+        return;
+    }
+
+    let cursor = Box::from_raw(cursor);
+    if let Some(prefetch) = cursor.prefetch {
+        prefetch.abort();
+    }
+}
+
 /// FFI function: Get messages after a specific message (pagination)
 /// Returns a JSON array string of Message objects
 /// The caller must free the returned string using communicator_free_string()
@@ -2659,9 +4746,9 @@ pub unsafe extern "C" fn communicator_platform_get_messages_after(
         after_id_str,
         limit as usize,
     )) {
-        Ok(messages) => match serde_json::to_string(&messages) {
+        Ok(messages) => match serialize_masked(handle as usize, "message", &messages) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -2900,7 +4987,7 @@ pub unsafe extern "C" fn communicator_platform_get_pinned_posts(
     match runtime::block_on(platform.get_pinned_posts(channel_id_str)) {
         Ok(messages) => match serde_json::to_string(&messages) {
             Ok(json) => match std::ffi::CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::Unknown,
@@ -2950,7 +5037,7 @@ pub unsafe extern "C" fn communicator_platform_get_emojis(
     match runtime::block_on(platform.get_emojis(page, per_page)) {
         Ok(emojis) => match serde_json::to_string(&emojis) {
             Ok(json_str) => match CString::new(json_str) {
-                Ok(c_str) => c_str.into_raw(),
+                Ok(c_str) => arena::export_c_string(c_str),
                 Err(_) => {
                     error::set_last_error(Error::invalid_utf8());
                     std::ptr::null_mut()
@@ -3017,7 +5104,7 @@ pub unsafe extern "C" fn communicator_platform_get_channel_by_name(
     match runtime::block_on(platform.get_channel_by_name(team_id_str, channel_name_str)) {
         Ok(channel) => match serde_json::to_string(&channel) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -3089,7 +5176,7 @@ pub unsafe extern "C" fn communicator_platform_create_group_channel(
     match runtime::block_on(platform.create_group_channel(user_ids)) {
         Ok(channel) => match serde_json::to_string(&channel) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -3250,7 +5337,7 @@ pub unsafe extern "C" fn communicator_platform_get_user_by_username(
     match runtime::block_on(platform.get_user_by_username(username_str)) {
         Ok(user) => match serde_json::to_string(&user) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -3309,7 +5396,7 @@ pub unsafe extern "C" fn communicator_platform_get_user_by_email(
     match runtime::block_on(platform.get_user_by_email(email_str)) {
         Ok(user) => match serde_json::to_string(&user) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -3381,7 +5468,7 @@ pub unsafe extern "C" fn communicator_platform_get_users_by_ids(
     match runtime::block_on(platform.get_users_by_ids(user_ids)) {
         Ok(users) => match serde_json::to_string(&users) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -3567,7 +5654,7 @@ pub unsafe extern "C" fn communicator_platform_get_users_status(
 
             match serde_json::to_string(&status_strings) {
                 Ok(json) => match CString::new(json) {
-                    Ok(c_string) => c_string.into_raw(),
+                    Ok(c_string) => arena::export_c_string(c_string),
                     Err(_) => {
                         error::set_last_error(Error::new(
                             ErrorCode::OutOfMemory,
@@ -3628,7 +5715,7 @@ pub unsafe extern "C" fn communicator_platform_get_team_by_name(
     match runtime::block_on(platform.get_team_by_name(team_name_str)) {
         Ok(team) => match serde_json::to_string(&team) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::OutOfMemory,
@@ -3756,7 +5843,88 @@ pub unsafe extern "C" fn communicator_platform_upload_file(
 
     match runtime::block_on(platform.upload_file(channel_id_str, path)) {
         Ok(file_id) => match CString::new(file_id) {
-            Ok(c_string) => c_string.into_raw(),
+            Ok(c_string) => arena::export_c_string(c_string),
+            Err(_) => {
+                error::set_last_error(Error::new(
+                    ErrorCode::Unknown,
+                    "Failed to convert file ID to C string",
+                ));
+                std::ptr::null_mut()
+            }
+        },
+        Err(e) => {
+            error::set_last_error(e);
+            std::ptr::null_mut()
+        }
+    }
+}
+
+/// Callback function type for upload progress reporting
+/// Parameters: bytes_sent, total_bytes (0 if unknown), user_data
+pub type UploadProgressCallback = extern "C" fn(u64, u64, *mut c_void);
+
+/// FFI function: Upload a file, streaming it from disk in bounded chunks
+/// Streaming variant of communicator_platform_upload_file: the file is never
+/// read into memory in full, so memory usage stays constant regardless of
+/// file size. The progress callback (may be NULL) is invoked as bytes are
+/// handed to the transport.
+/// Returns the file ID of the uploaded file
+/// The caller must free the returned string using communicator_free_string()
+/// Returns NULL on error
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid.
+pub unsafe extern "C" fn communicator_platform_upload_file_streaming(
+    handle: PlatformHandle,
+    channel_id: *const c_char,
+    file_path: *const c_char,
+    callback: Option<UploadProgressCallback>,
+    user_data: *mut c_void,
+) -> *mut c_char {
+    error::clear_last_error();
+
+    if handle.is_null() || channel_id.is_null() || file_path.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return std::ptr::null_mut();
+    }
+
+    let channel_id_str = {
+        match std::ffi::CStr::from_ptr(channel_id).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return std::ptr::null_mut();
+            }
+        }
+    };
+
+    let file_path_str = {
+        match std::ffi::CStr::from_ptr(file_path).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return std::ptr::null_mut();
+            }
+        }
+    };
+
+    let platform = &**handle;
+    let path = std::path::Path::new(file_path_str);
+
+    let progress = callback.map(|callback| {
+        let user_data = SendPtr(user_data);
+        let handler: platforms::ProgressHandler = Box::new(move |sent, total| {
+            let user_data = &user_data;
+            callback(sent, total, user_data.0);
+        });
+        handler
+    });
+
+    match runtime::block_on(platform.upload_file_streaming(channel_id_str, path, progress)) {
+        Ok(file_id) => match CString::new(file_id) {
+            Ok(c_string) => arena::export_c_string(c_string),
             Err(_) => {
                 error::set_last_error(Error::new(
                     ErrorCode::Unknown,
@@ -3830,6 +5998,63 @@ pub unsafe extern "C" fn communicator_platform_download_file(
     }
 }
 
+/// Callback function type for streaming download chunks
+/// Parameters: data, size, user_data; return non-zero to continue, 0 to cancel
+pub type DownloadChunkCallback = extern "C" fn(*const u8, usize, *mut c_void) -> i32;
+
+/// FFI function: Download a file, delivering the body in chunks
+/// Streaming variant of communicator_platform_download_file: the callback is
+/// invoked with each chunk as it arrives from the network, so memory usage
+/// stays constant regardless of file size. The data pointer is only valid for
+/// the duration of the call. The call blocks until the download completes, is
+/// cancelled by the callback returning 0, or fails.
+/// Returns ErrorCode indicating success or failure
+#[no_mangle]
+///
+/// # Safety
+/// This function is unsafe because it deals with raw pointers from C.
+/// The caller must ensure all pointer arguments are valid.
+pub unsafe extern "C" fn communicator_platform_download_file_streaming(
+    handle: PlatformHandle,
+    file_id: *const c_char,
+    callback: DownloadChunkCallback,
+    user_data: *mut c_void,
+) -> ErrorCode {
+    error::clear_last_error();
+
+    if handle.is_null() || file_id.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return ErrorCode::NullPointer;
+    }
+
+    let file_id_str = {
+        match std::ffi::CStr::from_ptr(file_id).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return ErrorCode::InvalidUtf8;
+            }
+        }
+    };
+
+    let platform = &**handle;
+
+    let user_data = SendPtr(user_data);
+    let handler: platforms::ChunkHandler = Box::new(move |chunk: &[u8]| {
+        let user_data = &user_data;
+        callback(chunk.as_ptr(), chunk.len(), user_data.0) != 0
+    });
+
+    match runtime::block_on(platform.download_file_streaming(file_id_str, handler)) {
+        Ok(()) => ErrorCode::Success,
+        Err(e) => {
+            let code = e.code;
+            error::set_last_error(e);
+            code
+        }
+    }
+}
+
 /// FFI function: Get file metadata without downloading the file
 /// Returns a JSON string representing the Attachment metadata
 /// The caller must free the returned string using communicator_free_string()
@@ -3869,7 +6094,7 @@ pub unsafe extern "C" fn communicator_platform_get_file_metadata(
     match runtime::block_on(platform.get_file_metadata(file_id_str)) {
         Ok(attachment) => match serde_json::to_string(&attachment) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::Unknown,
@@ -4049,7 +6274,7 @@ pub unsafe extern "C" fn communicator_platform_get_file_link(
 
     match runtime::block_on(platform.get_file_link(file_id_str)) {
         Ok(link) => match CString::new(link) {
-            Ok(c_string) => c_string.into_raw(),
+            Ok(c_string) => arena::export_c_string(c_string),
             Err(_) => {
                 error::set_last_error(Error::new(
                     ErrorCode::Unknown,
@@ -4103,7 +6328,7 @@ pub unsafe extern "C" fn communicator_platform_get_thread(
     match runtime::block_on(platform.get_thread(post_id_str)) {
         Ok(messages) => match serde_json::to_string(&messages) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::Unknown,
@@ -4352,7 +6577,7 @@ pub unsafe extern "C" fn communicator_platform_get_user_threads(
         page,
     )) {
         Ok(json) => match CString::new(json) {
-            Ok(c_string) => c_string.into_raw(),
+            Ok(c_string) => arena::export_c_string(c_string),
             Err(_) => {
                 error::set_last_error(Error::new(
                     ErrorCode::Unknown,
@@ -4420,7 +6645,7 @@ pub unsafe extern "C" fn communicator_platform_get_user_thread(
 
     match runtime::block_on(platform.get_user_thread(user_id_str, team_id_str, thread_id_str)) {
         Ok(json) => match CString::new(json) {
-            Ok(c_string) => c_string.into_raw(),
+            Ok(c_string) => arena::export_c_string(c_string),
             Err(_) => {
                 error::set_last_error(Error::new(
                     ErrorCode::Unknown,
@@ -4523,7 +6748,7 @@ pub unsafe extern "C" fn communicator_platform_search_messages(
     match runtime::block_on(platform.search_messages(query_str, limit)) {
         Ok(messages) => match serde_json::to_string(&messages) {
             Ok(json) => match std::ffi::CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::Unknown,
@@ -4547,6 +6772,84 @@ pub unsafe extern "C" fn communicator_platform_search_messages(
     }
 }
 
+/// FFI function: Search messages in the local index, falling back to the server
+///
+/// Queries the embedded message index (configured via the
+/// `message_index.path` context key) with zero network I/O. When the
+/// index is not configured, falls back to a server-side search so
+/// callers can use this unconditionally.
+///
+/// # Arguments
+/// * `handle` - Platform handle
+/// * `query` - Search terms, all of which must match (text, channel ID, or sender ID)
+/// * `limit` - Maximum number of results
+///
+/// # Returns
+/// JSON array of messages on success, or null on error
+///
+/// # Safety
+/// The caller must ensure all pointer arguments are valid.
+#[no_mangle]
+pub unsafe extern "C" fn communicator_platform_search_messages_local(
+    handle: PlatformHandle,
+    query: *const c_char,
+    limit: u32,
+) -> *mut c_char {
+    error::clear_last_error();
+
+    if handle.is_null() || query.is_null() {
+        error::set_last_error(Error::null_pointer());
+        return std::ptr::null_mut();
+    }
+
+    let query_str = {
+        match std::ffi::CStr::from_ptr(query).to_str() {
+            Ok(s) => s,
+            Err(_) => {
+                error::set_last_error(Error::invalid_utf8());
+                return std::ptr::null_mut();
+            }
+        }
+    };
+
+    let _timer = metrics::timer("search_messages_local");
+
+    let result = match message_index::search(query_str, limit as usize) {
+        Some(messages) => Ok(messages),
+        None => {
+            // Index not configured - fall back to server search
+            let platform = &**handle;
+            runtime::block_on(platform.search_messages(query_str, limit as usize))
+        }
+    };
+
+    match result {
+        Ok(messages) => match serde_json::to_string(&messages) {
+            Ok(json) => match std::ffi::CString::new(json) {
+                Ok(c_string) => arena::export_c_string(c_string),
+                Err(_) => {
+                    error::set_last_error(Error::new(
+                        ErrorCode::Unknown,
+                        "Failed to convert result to C string",
+                    ));
+                    std::ptr::null_mut()
+                }
+            },
+            Err(e) => {
+                error::set_last_error(Error::new(
+                    ErrorCode::Unknown,
+                    format!("Failed to serialize messages: {e}"),
+                ));
+                std::ptr::null_mut()
+            }
+        },
+        Err(e) => {
+            error::set_last_error(e);
+            std::ptr::null_mut()
+        }
+    }
+}
+
 // ============================================================================
 // Advanced Search Operations
 // ============================================================================
@@ -4605,7 +6908,7 @@ pub unsafe extern "C" fn communicator_platform_search_users(
     match runtime::block_on(platform.search_users(query, limit)) {
         Ok(users) => match serde_json::to_string(&users) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::Unknown,
@@ -4689,7 +6992,7 @@ pub unsafe extern "C" fn communicator_platform_autocomplete_users(
     match runtime::block_on(platform.autocomplete_users(channel_id_str, name_str, limit)) {
         Ok(users) => match serde_json::to_string(&users) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::Unknown,
@@ -4758,7 +7061,7 @@ pub unsafe extern "C" fn communicator_platform_search_channels(
     match runtime::block_on(platform.search_channels(term_str, 100)) {
         Ok(channels) => match serde_json::to_string(&channels) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::Unknown,
@@ -4827,7 +7130,7 @@ pub unsafe extern "C" fn communicator_platform_autocomplete_channels(
     match runtime::block_on(platform.autocomplete_channels(name_str, 100)) {
         Ok(channels) => match serde_json::to_string(&channels) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::Unknown,
@@ -4986,7 +7289,7 @@ pub unsafe extern "C" fn communicator_platform_get_user_preferences(
 
     match runtime::block_on(platform.get_user_preferences(user_id_str)) {
         Ok(json) => match CString::new(json) {
-            Ok(c_string) => c_string.into_raw(),
+            Ok(c_string) => arena::export_c_string(c_string),
             Err(_) => {
                 error::set_last_error(Error::new(
                     ErrorCode::OutOfMemory,
@@ -5282,7 +7585,7 @@ pub unsafe extern "C" fn communicator_platform_get_channel_unread(
     };
 
     match CString::new(json) {
-        Ok(c_string) => c_string.into_raw(),
+        Ok(c_string) => arena::export_c_string(c_string),
         Err(_) => {
             error::set_last_error(Error::invalid_utf8());
             std::ptr::null_mut()
@@ -5342,7 +7645,7 @@ pub unsafe extern "C" fn communicator_platform_get_team_unreads(
     };
 
     match CString::new(json) {
-        Ok(c_string) => c_string.into_raw(),
+        Ok(c_string) => arena::export_c_string(c_string),
         Err(_) => {
             error::set_last_error(Error::invalid_utf8());
             std::ptr::null_mut()
@@ -5370,7 +7673,7 @@ pub unsafe extern "C" fn communicator_platform_get_all_unreads(
     match runtime::block_on(platform.get_all_unreads()) {
         Ok(unreads) => match serde_json::to_string(&unreads) {
             Ok(json) => match CString::new(json) {
-                Ok(c_string) => c_string.into_raw(),
+                Ok(c_string) => arena::export_c_string(c_string),
                 Err(_) => {
                     error::set_last_error(Error::new(
                         ErrorCode::Unknown,
@@ -5426,7 +7729,7 @@ pub unsafe extern "C" fn communicator_platform_get_unread_posts(
 
     match runtime::block_on(platform.get_unread_posts(channel_id_str, limit_after, limit_before)) {
         Ok(json) => match CString::new(json) {
-            Ok(c_string) => c_string.into_raw(),
+            Ok(c_string) => arena::export_c_string(c_string),
             Err(_) => {
                 error::set_last_error(Error::new(
                     ErrorCode::Unknown,
@@ -5459,6 +7762,10 @@ pub unsafe extern "C" fn communicator_platform_get_unread_posts(
 /// The caller must ensure all pointer arguments are valid.
 pub unsafe extern "C" fn communicator_platform_destroy(handle: PlatformHandle) {
     if !handle.is_null() {
+        // Drop any response field masks registered for this handle
+        if let Ok(mut masks) = RESPONSE_FIELD_MASKS.lock() {
+            masks.retain(|(addr, _), _| *addr != handle as usize);
+        }
         let _ = Box::from_raw(handle);
     }
 }
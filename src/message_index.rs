@@ -0,0 +1,325 @@
+//! Opt-in local message index for instant history search
+//!
+//! Server-side message search is slow and rate-limited on many
+//! installations, while the library already sees every message through
+//! WebSocket `posted` events and history fetches. This module keeps those
+//! messages in an embedded store: an append-only JSON-lines log on disk
+//! and an in-memory inverted term index over message text, channel, and
+//! author, rebuilt from the log on startup.
+//!
+//! The index is disabled until configured through the context
+//! (`message_index.path` via `communicator_context_set_config`, applied
+//! on `communicator_context_initialize`). Queries go through
+//! `communicator_platform_search_messages_local`, which falls back to
+//! server search when the index is not configured. Ingest failures
+//! degrade silently - indexing must never break message delivery.
+
+use std::collections::HashMap;
+use std::fs;
+use std::io::{BufRead, Write};
+use std::path::{Path, PathBuf};
+use std::sync::Mutex;
+use std::sync::OnceLock;
+
+use crate::error::{Error, ErrorCode, Result};
+use crate::types::Message;
+
+/// The process-wide index instance, set once by `init`
+static MESSAGE_INDEX: OnceLock<MessageIndex> = OnceLock::new();
+
+/// Initialize the process-wide message index
+///
+/// Replays the on-disk log so the index survives restarts. Only the
+/// first call takes effect, mirroring the shared runtime's
+/// initialization semantics.
+pub fn init(path: &str) -> Result<()> {
+    let index = MessageIndex::open(Path::new(path))?;
+    let _ = MESSAGE_INDEX.set(index);
+    Ok(())
+}
+
+/// Add a message to the index; a no-op when the index is not configured
+pub(crate) fn ingest(message: &Message) {
+    if let Some(index) = MESSAGE_INDEX.get() {
+        index.ingest(message);
+    }
+}
+
+/// Search the index; None when the index is not configured
+pub(crate) fn search(query: &str, limit: usize) -> Option<Vec<Message>> {
+    MESSAGE_INDEX.get().map(|index| index.search(query, limit))
+}
+
+/// Embedded message store with an inverted term index
+///
+/// Messages are appended to a JSON-lines log as they arrive and indexed
+/// in memory by the terms of their text plus their channel and sender
+/// IDs. Re-ingesting a known message ID replaces the indexed copy (edits)
+/// without rewriting the log; on reload the last occurrence wins.
+pub struct MessageIndex {
+    log_path: PathBuf,
+    inner: Mutex<IndexInner>,
+}
+
+struct IndexInner {
+    /// Indexed messages in ingest order; slots of replaced edits stay
+    /// allocated but are superseded via `by_id`
+    messages: Vec<Message>,
+    /// Message ID to slot, for dedupe and edit replacement
+    by_id: HashMap<String, usize>,
+    /// Term to posting list of slots, sorted ascending
+    terms: HashMap<String, Vec<usize>>,
+    /// Append handle to the on-disk log
+    log: Option<fs::File>,
+}
+
+impl MessageIndex {
+    /// Open (or create) the index, replaying the log into memory
+    fn open(path: &Path) -> Result<Self> {
+        if let Some(parent) = path.parent() {
+            if !parent.as_os_str().is_empty() {
+                fs::create_dir_all(parent).map_err(|e| {
+                    Error::new(
+                        ErrorCode::InvalidArgument,
+                        format!("Failed to create message index directory: {e}"),
+                    )
+                })?;
+            }
+        }
+
+        let mut inner = IndexInner {
+            messages: Vec::new(),
+            by_id: HashMap::new(),
+            terms: HashMap::new(),
+            log: None,
+        };
+
+        // Replay the existing log; unparsable lines (torn writes from a
+        // crash) are skipped rather than failing the whole load
+        if let Ok(file) = fs::File::open(path) {
+            for line in std::io::BufReader::new(file).lines() {
+                let Ok(line) = line else { break };
+                if let Ok(message) = serde_json::from_str::<Message>(&line) {
+                    Self::index_message(&mut inner, message);
+                }
+            }
+        }
+
+        inner.log = Some(
+            fs::OpenOptions::new()
+                .create(true)
+                .append(true)
+                .open(path)
+                .map_err(|e| {
+                    Error::new(
+                        ErrorCode::InvalidArgument,
+                        format!("Failed to open message index log: {e}"),
+                    )
+                })?,
+        );
+
+        Ok(Self {
+            log_path: path.to_path_buf(),
+            inner: Mutex::new(inner),
+        })
+    }
+
+    /// Add or update a message, appending it to the log
+    fn ingest(&self, message: &Message) {
+        let mut inner = self.inner.lock().unwrap_or_else(|e| e.into_inner());
+
+        // Skip exact duplicates (the same post seen via both a history
+        // fetch and the event stream); edits carry a new edited_at and
+        // are re-indexed
+        if let Some(&slot) = inner.by_id.get(&message.id) {
+            if inner.messages[slot].edited_at == message.edited_at {
+                return;
+            }
+        }
+
+        if let Ok(line) = serde_json::to_string(message) {
+            if let Some(log) = inner.log.as_mut() {
+                let _ = writeln!(log, "{line}");
+            }
+        }
+
+        Self::index_message(&mut inner, message.clone());
+    }
+
+    /// Index a message in memory, replacing a previously indexed edit
+    fn index_message(inner: &mut IndexInner, message: Message) {
+        let slot = match inner.by_id.get(&message.id) {
+            Some(&slot) => {
+                inner.messages[slot] = message;
+                slot
+            }
+            None => {
+                let slot = inner.messages.len();
+                inner.by_id.insert(message.id.clone(), slot);
+                inner.messages.push(message);
+                slot
+            }
+        };
+
+        let message = &inner.messages[slot];
+        let mut terms = tokenize(&message.text);
+        terms.push(message.channel_id.to_lowercase());
+        terms.push(message.sender_id.to_lowercase());
+        for term in terms {
+            let postings = inner.terms.entry(term).or_default();
+            if let Err(pos) = postings.binary_search(&slot) {
+                postings.insert(pos, slot);
+            }
+        }
+    }
+
+    /// Search for messages matching every term of the query
+    ///
+    /// Terms match against message text, channel ID, and sender ID.
+    /// Results are newest-first by creation time, capped at `limit`.
+    fn search(&self, query: &str, limit: usize) -> Vec<Message> {
+        let query_terms = tokenize(query);
+        if query_terms.is_empty() {
+            return Vec::new();
+        }
+
+        let inner = self.inner.lock().unwrap_or_else(|e| e.into_inner());
+
+        // Intersect posting lists, starting from the rarest term
+        let mut postings: Vec<&Vec<usize>> = Vec::with_capacity(query_terms.len());
+        for term in &query_terms {
+            match inner.terms.get(term) {
+                Some(list) => postings.push(list),
+                None => return Vec::new(),
+            }
+        }
+        postings.sort_by_key(|list| list.len());
+
+        let mut slots: Vec<usize> = postings[0].clone();
+        for list in &postings[1..] {
+            slots.retain(|slot| list.binary_search(slot).is_ok());
+            if slots.is_empty() {
+                return Vec::new();
+            }
+        }
+
+        // Posting lists can be stale after an edit (the old wording's
+        // terms still point at the slot), so verify candidates against
+        // the current message before returning them
+        let mut results: Vec<&Message> = slots
+            .into_iter()
+            .map(|slot| &inner.messages[slot])
+            .filter(|message| message_matches(message, &query_terms))
+            .collect();
+        results.sort_by(|a, b| b.created_at.cmp(&a.created_at));
+        results.into_iter().take(limit).cloned().collect()
+    }
+
+    /// Path of the on-disk log backing this index
+    pub fn log_path(&self) -> &Path {
+        &self.log_path
+    }
+}
+
+/// Whether a message currently matches every query term
+fn message_matches(message: &Message, terms: &[String]) -> bool {
+    let text_terms = tokenize(&message.text);
+    terms.iter().all(|term| {
+        text_terms.contains(term)
+            || message.channel_id.eq_ignore_ascii_case(term)
+            || message.sender_id.eq_ignore_ascii_case(term)
+    })
+}
+
+/// Split text into lowercase alphanumeric terms
+fn tokenize(text: &str) -> Vec<String> {
+    text.split(|c: char| !c.is_alphanumeric())
+        .filter(|term| !term.is_empty())
+        .map(|term| term.to_lowercase())
+        .collect()
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn temp_log(name: &str) -> PathBuf {
+        let path = std::env::temp_dir().join(format!("communicator-message-index-{name}.jsonl"));
+        let _ = fs::remove_file(&path);
+        path
+    }
+
+    fn message(id: &str, text: &str, sender: &str, channel: &str) -> Message {
+        Message::new(id, text, sender, channel)
+    }
+
+    #[test]
+    fn test_search_matches_text_channel_and_author() {
+        let path = temp_log("fields");
+        let index = MessageIndex::open(&path).unwrap();
+
+        index.ingest(&message("m1", "deploy finished", "alice", "ops"));
+        index.ingest(&message("m2", "lunch anyone", "bob", "random"));
+
+        assert_eq!(index.search("deploy", 10).len(), 1);
+        assert_eq!(index.search("ops", 10).len(), 1);
+        assert_eq!(index.search("bob", 10)[0].id, "m2");
+        // All terms must match
+        assert_eq!(index.search("deploy lunch", 10).len(), 0);
+        assert_eq!(index.search("deploy alice", 10).len(), 1);
+
+        let _ = fs::remove_file(&path);
+    }
+
+    #[test]
+    fn test_reload_from_log() {
+        let path = temp_log("reload");
+        {
+            let index = MessageIndex::open(&path).unwrap();
+            index.ingest(&message("m1", "persisted across restarts", "alice", "ops"));
+        }
+
+        let reopened = MessageIndex::open(&path).unwrap();
+        let results = reopened.search("persisted", 10);
+        assert_eq!(results.len(), 1);
+        assert_eq!(results[0].id, "m1");
+
+        let _ = fs::remove_file(&path);
+    }
+
+    #[test]
+    fn test_duplicate_ingest_and_edit_replacement() {
+        let path = temp_log("edits");
+        let index = MessageIndex::open(&path).unwrap();
+
+        let original = message("m1", "first wording", "alice", "ops");
+        index.ingest(&original);
+        index.ingest(&original); // duplicate delivery
+
+        let mut edited = original.clone();
+        edited.text = "second wording".to_string();
+        edited.edited_at = Some(chrono::Utc::now());
+        index.ingest(&edited);
+
+        assert_eq!(index.search("second", 10).len(), 1);
+        // The superseded copy no longer surfaces under its old terms
+        assert_eq!(index.search("first", 10).len(), 0);
+
+        let _ = fs::remove_file(&path);
+    }
+
+    #[test]
+    fn test_limit_and_ordering() {
+        let path = temp_log("limit");
+        let index = MessageIndex::open(&path).unwrap();
+
+        for i in 0..5 {
+            index.ingest(&message(&format!("m{i}"), "common term", "alice", "ops"));
+        }
+
+        let results = index.search("common", 3);
+        assert_eq!(results.len(), 3);
+
+        let _ = fs::remove_file(&path);
+    }
+}
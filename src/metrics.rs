@@ -0,0 +1,229 @@
+//! Pull-based metrics for FFI operations
+//!
+//! The library must stay silent (no stdout/stderr), so observability is
+//! pull-based: hot FFI entry points record call counts and latency into a
+//! process-wide registry, and consumers retrieve a JSON snapshot through
+//! `communicator_platform_get_metrics`. Platform-specific counters
+//! (WebSocket reconnects, queue depth) live with the platform and are
+//! merged into the same snapshot.
+//!
+//! Recording is lock-free after the first call per operation: histograms
+//! use relaxed atomics and the registry read path takes a shared lock only
+//! to look up the histogram handle.
+
+use std::collections::HashMap;
+use std::sync::atomic::{AtomicU64, Ordering};
+use std::sync::{Arc, RwLock};
+use std::time::Instant;
+
+use lazy_static::lazy_static;
+
+/// Number of latency buckets: powers of two from 1 µs up, last is overflow
+const BUCKET_COUNT: usize = 21;
+
+/// A latency histogram with power-of-two microsecond buckets
+///
+/// Bucket `i` counts samples with latency <= 2^i µs; the last bucket
+/// catches everything slower (~0.5 s and up).
+#[derive(Debug, Default)]
+pub struct Histogram {
+    buckets: [AtomicU64; BUCKET_COUNT],
+    count: AtomicU64,
+    sum_us: AtomicU64,
+}
+
+impl Histogram {
+    /// Record one sample in microseconds
+    pub fn record_us(&self, us: u64) {
+        let bucket = if us <= 1 {
+            0
+        } else {
+            ((64 - (us - 1).leading_zeros()) as usize).min(BUCKET_COUNT - 1)
+        };
+        self.buckets[bucket].fetch_add(1, Ordering::Relaxed);
+        self.count.fetch_add(1, Ordering::Relaxed);
+        self.sum_us.fetch_add(us, Ordering::Relaxed);
+    }
+
+    /// Number of recorded samples
+    pub fn count(&self) -> u64 {
+        self.count.load(Ordering::Relaxed)
+    }
+
+    /// Reset all buckets and counters to zero
+    pub fn reset(&self) {
+        for bucket in &self.buckets {
+            bucket.store(0, Ordering::Relaxed);
+        }
+        self.count.store(0, Ordering::Relaxed);
+        self.sum_us.store(0, Ordering::Relaxed);
+    }
+
+    /// Snapshot as JSON: total count, total time, and non-empty buckets
+    /// keyed by their upper bound in microseconds ("inf" for the overflow
+    /// bucket)
+    pub fn snapshot(&self) -> serde_json::Value {
+        let mut buckets = serde_json::Map::new();
+        for (i, bucket) in self.buckets.iter().enumerate() {
+            let count = bucket.load(Ordering::Relaxed);
+            if count == 0 {
+                continue;
+            }
+            let key = if i == BUCKET_COUNT - 1 {
+                "inf".to_string()
+            } else {
+                (1u64 << i).to_string()
+            };
+            buckets.insert(key, serde_json::Value::from(count));
+        }
+        serde_json::json!({
+            "count": self.count.load(Ordering::Relaxed),
+            "total_us": self.sum_us.load(Ordering::Relaxed),
+            "buckets_le_us": buckets,
+        })
+    }
+}
+
+/// Process-wide registry of per-operation histograms
+#[derive(Debug, Default)]
+struct Registry {
+    operations: RwLock<HashMap<&'static str, Arc<Histogram>>>,
+}
+
+lazy_static! {
+    static ref REGISTRY: Registry = Registry::default();
+}
+
+/// Guard that records the elapsed time of an FFI operation when dropped
+///
+/// Created by [`timer`]; recording on drop covers every return path of the
+/// instrumented function, including early error returns.
+pub struct OpTimer {
+    histogram: Arc<Histogram>,
+    start: Instant,
+}
+
+impl Drop for OpTimer {
+    fn drop(&mut self) {
+        self.histogram
+            .record_us(self.start.elapsed().as_micros() as u64);
+    }
+}
+
+/// Start timing an FFI operation
+///
+/// # Arguments
+/// * `operation` - A stable operation name, typically the FFI function
+///   name without the `communicator_platform_` prefix
+pub fn timer(operation: &'static str) -> OpTimer {
+    let histogram = {
+        let operations = REGISTRY
+            .operations
+            .read()
+            .unwrap_or_else(|e| e.into_inner());
+        operations.get(operation).cloned()
+    };
+    let histogram = match histogram {
+        Some(h) => h,
+        None => {
+            let mut operations = REGISTRY
+                .operations
+                .write()
+                .unwrap_or_else(|e| e.into_inner());
+            Arc::clone(
+                operations
+                    .entry(operation)
+                    .or_insert_with(|| Arc::new(Histogram::default())),
+            )
+        }
+    };
+    OpTimer {
+        histogram,
+        start: Instant::now(),
+    }
+}
+
+/// Snapshot every operation's histogram as a JSON object keyed by name
+pub fn snapshot() -> serde_json::Value {
+    let operations = REGISTRY
+        .operations
+        .read()
+        .unwrap_or_else(|e| e.into_inner());
+    let mut map = serde_json::Map::new();
+    for (name, histogram) in operations.iter() {
+        if histogram.count() > 0 {
+            map.insert((*name).to_string(), histogram.snapshot());
+        }
+    }
+    serde_json::Value::Object(map)
+}
+
+/// Reset all operation histograms to zero
+pub fn reset() {
+    let operations = REGISTRY
+        .operations
+        .read()
+        .unwrap_or_else(|e| e.into_inner());
+    for histogram in operations.values() {
+        histogram.reset();
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_histogram_bucket_boundaries() {
+        let h = Histogram::default();
+        h.record_us(1); // bucket 0 (<= 1)
+        h.record_us(2); // bucket 1 (<= 2)
+        h.record_us(3); // bucket 2 (<= 4)
+        h.record_us(1024); // bucket 10
+        h.record_us(u64::MAX / 2); // overflow bucket
+
+        assert_eq!(h.count(), 5);
+        let snapshot = h.snapshot();
+        let buckets = snapshot["buckets_le_us"].as_object().unwrap();
+        assert_eq!(buckets["1"], 1);
+        assert_eq!(buckets["2"], 1);
+        assert_eq!(buckets["4"], 1);
+        assert_eq!(buckets["1024"], 1);
+        assert_eq!(buckets["inf"], 1);
+    }
+
+    #[test]
+    fn test_histogram_reset() {
+        let h = Histogram::default();
+        h.record_us(10);
+        h.record_us(100);
+        assert_eq!(h.count(), 2);
+
+        h.reset();
+        assert_eq!(h.count(), 0);
+        assert!(h.snapshot()["buckets_le_us"]
+            .as_object()
+            .unwrap()
+            .is_empty());
+    }
+
+    #[test]
+    fn test_timer_records_into_registry() {
+        {
+            let _timer = timer("test_timer_records_op");
+        }
+        let snapshot = snapshot();
+        assert_eq!(snapshot["test_timer_records_op"]["count"], 1);
+    }
+
+    #[test]
+    fn test_registry_reset() {
+        {
+            let _timer = timer("test_registry_reset_op");
+        }
+        reset();
+        let snapshot = snapshot();
+        // Reset histograms are skipped in the snapshot
+        assert!(snapshot.get("test_registry_reset_op").is_none());
+    }
+}
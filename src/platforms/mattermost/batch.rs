@@ -0,0 +1,123 @@
+//! Bounded-concurrency batch execution over the HTTP client
+//!
+//! Fetching a per-key resource for hundreds of keys (e.g. members for every
+//! channel in a team) as serialized round trips takes minutes. This module
+//! runs the per-key operations concurrently on the runtime, bounded so a
+//! large batch does not exhaust connections or trip server rate limits, and
+//! collects per-key results in input order.
+
+use futures::stream::{self, StreamExt};
+use std::future::Future;
+
+use crate::error::Result;
+
+/// Default number of operations in flight at once
+///
+/// Matches typical per-client connection budgets; high enough to hide
+/// request latency, low enough to stay clear of server rate limits.
+pub const DEFAULT_BULK_CONCURRENCY: usize = 8;
+
+/// Run an async operation for each key with bounded concurrency
+///
+/// At most `concurrency` operations are in flight at once. Each key gets
+/// its own result, so one failing operation does not abort the batch.
+/// Results are returned in the same order as the input keys.
+///
+/// # Arguments
+/// * `keys` - The keys to run the operation for
+/// * `concurrency` - Maximum number of operations in flight at once
+/// * `op` - The operation to run for each key
+pub async fn execute_bulk<K, T, F, Fut>(
+    keys: Vec<K>,
+    concurrency: usize,
+    op: F,
+) -> Vec<(K, Result<T>)>
+where
+    K: Clone,
+    F: Fn(K) -> Fut,
+    Fut: Future<Output = Result<T>>,
+{
+    stream::iter(keys.into_iter().map(|key| {
+        let fut = op(key.clone());
+        async move { (key, fut.await) }
+    }))
+    .buffered(concurrency.max(1))
+    .collect()
+    .await
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use crate::error::{Error, ErrorCode};
+    use std::sync::atomic::{AtomicUsize, Ordering};
+    use std::sync::Arc;
+    use std::time::Duration;
+
+    #[tokio::test]
+    async fn test_results_keep_input_order() {
+        let keys: Vec<String> = (0..20).map(|i| format!("key{i}")).collect();
+        let results = execute_bulk(keys.clone(), 4, |key| async move {
+            // Vary completion time so order cannot come from timing
+            let delay = (key.len() % 3) as u64 * 10;
+            tokio::time::sleep(Duration::from_millis(delay)).await;
+            Ok(format!("value for {key}"))
+        })
+        .await;
+
+        let result_keys: Vec<String> = results.iter().map(|(k, _)| k.clone()).collect();
+        assert_eq!(result_keys, keys);
+        assert!(results.iter().all(|(_, r)| r.is_ok()));
+    }
+
+    #[tokio::test]
+    async fn test_concurrency_is_bounded() {
+        let in_flight = Arc::new(AtomicUsize::new(0));
+        let max_in_flight = Arc::new(AtomicUsize::new(0));
+
+        let keys: Vec<u32> = (0..20).collect();
+        let results = execute_bulk(keys, 4, |key| {
+            let in_flight = Arc::clone(&in_flight);
+            let max_in_flight = Arc::clone(&max_in_flight);
+            async move {
+                let current = in_flight.fetch_add(1, Ordering::SeqCst) + 1;
+                max_in_flight.fetch_max(current, Ordering::SeqCst);
+                tokio::time::sleep(Duration::from_millis(10)).await;
+                in_flight.fetch_sub(1, Ordering::SeqCst);
+                Ok(key * 2)
+            }
+        })
+        .await;
+
+        assert_eq!(results.len(), 20);
+        assert!(max_in_flight.load(Ordering::SeqCst) <= 4);
+    }
+
+    #[tokio::test]
+    async fn test_failures_do_not_abort_the_batch() {
+        let keys: Vec<u32> = (0..6).collect();
+        let results = execute_bulk(keys, 2, |key| async move {
+            if key % 2 == 0 {
+                Ok(key)
+            } else {
+                Err(Error::new(ErrorCode::NetworkError, "boom"))
+            }
+        })
+        .await;
+
+        assert_eq!(results.len(), 6);
+        for (key, result) in results {
+            if key % 2 == 0 {
+                assert_eq!(result.unwrap(), key);
+            } else {
+                assert_eq!(result.unwrap_err().code, ErrorCode::NetworkError);
+            }
+        }
+    }
+
+    #[tokio::test]
+    async fn test_zero_concurrency_is_clamped() {
+        let results = execute_bulk(vec![1u32], 0, |key| async move { Ok(key) }).await;
+        assert_eq!(results.len(), 1);
+    }
+}
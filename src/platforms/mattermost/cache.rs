@@ -2,25 +2,45 @@
 //!
 //! This module provides thread-safe, TTL-based caching to reduce redundant API calls
 //! and improve performance. Caches are automatically invalidated via WebSocket events.
+//!
+//! Entries are spread across a fixed number of shards, each behind its own
+//! lock, so concurrent callers do not contend on a single lock. Every cache
+//! is size-bounded: when a shard is full, expired entries are dropped first
+//! and then the least-recently-used entry is evicted. Hit/miss/eviction
+//! counters are tracked for tuning TTLs and capacities from production data.
 
+use std::collections::hash_map::DefaultHasher;
 use std::collections::HashMap;
+use std::hash::{Hash, Hasher};
+use std::sync::atomic::{AtomicU64, Ordering};
 use std::sync::Arc;
 use std::time::{Duration, Instant};
 use tokio::sync::RwLock;
 
-/// A cache entry with TTL expiration
-#[derive(Debug, Clone)]
+/// Number of shards per cache
+///
+/// Must be a power of two so the hash can be masked into a shard index.
+const SHARD_COUNT: usize = 8;
+
+/// Default maximum number of entries per cache
+const DEFAULT_MAX_ENTRIES: usize = 10_000;
+
+/// A cache entry with TTL expiration and LRU bookkeeping
+#[derive(Debug)]
 struct CacheEntry<T> {
     value: T,
     expires_at: Instant,
+    /// Milliseconds since the cache was created, updated on each hit
+    last_used: AtomicU64,
 }
 
 impl<T> CacheEntry<T> {
     /// Create a new cache entry with TTL
-    fn new(value: T, ttl: Duration) -> Self {
+    fn new(value: T, ttl: Duration, now_ms: u64) -> Self {
         Self {
             value,
             expires_at: Instant::now() + ttl,
+            last_used: AtomicU64::new(now_ms),
         }
     }
 
@@ -30,26 +50,56 @@ impl<T> CacheEntry<T> {
     }
 }
 
+/// Counters describing how a cache is performing
+#[derive(Debug, Clone, Default, serde::Serialize)]
+pub struct CacheStats {
+    /// Lookups that returned a cached value
+    pub hits: u64,
+    /// Lookups that found nothing (or only an expired entry)
+    pub misses: u64,
+    /// Entries removed to make room for new ones
+    pub evictions: u64,
+    /// Current number of entries across all shards
+    pub entries: usize,
+    /// Configured maximum number of entries
+    pub max_entries: usize,
+}
+
+/// A single cache shard: a map of entries behind its own lock
+type Shard<T> = RwLock<HashMap<String, CacheEntry<T>>>;
+
 /// Generic thread-safe cache with TTL-based expiration
 ///
 /// # Type Parameters
 /// * `T` - The type of value to cache (must be Clone)
 ///
 /// # Features
-/// - Thread-safe: Uses Arc<RwLock> for concurrent access
+/// - Thread-safe: Sharded storage, each shard behind its own RwLock
 /// - TTL-based expiration: Entries automatically expire after configured duration
-/// - Automatic cleanup: Expired entries are removed on access
-/// - Memory efficient: Only stores unexpired entries
+/// - Size-bounded: Least-recently-used entries are evicted at capacity
+/// - Observable: Hit/miss/eviction counters for tuning from production data
 #[derive(Debug, Clone)]
 pub struct Cache<T: Clone> {
-    /// Storage for cache entries
-    entries: Arc<RwLock<HashMap<String, CacheEntry<T>>>>,
+    /// Sharded storage for cache entries
+    shards: Arc<Vec<Shard<T>>>,
     /// Time-to-live for cache entries
     ttl: Duration,
+    /// Maximum number of entries in a single shard
+    max_per_shard: usize,
+    /// Configured maximum number of entries across all shards
+    max_entries: usize,
+    /// Reference point for LRU timestamps
+    epoch: Instant,
+    /// Lookups that returned a cached value
+    hits: Arc<AtomicU64>,
+    /// Lookups that found nothing usable
+    misses: Arc<AtomicU64>,
+    /// Entries removed to make room for new ones
+    evictions: Arc<AtomicU64>,
 }
 
 impl<T: Clone> Cache<T> {
-    /// Create a new cache with specified TTL
+    /// Create a new cache with specified TTL and the default capacity
     ///
     /// # Arguments
     /// * `ttl` - Time-to-live duration for cache entries
@@ -60,12 +110,43 @@ impl<T: Clone> Cache<T> {
     /// let cache = Cache::<String>::new(Duration::from_secs(300)); // 5 minute TTL
     /// ```
     pub fn new(ttl: Duration) -> Self {
+        Self::with_capacity(ttl, DEFAULT_MAX_ENTRIES)
+    }
+
+    /// Create a new cache with specified TTL and maximum entry count
+    ///
+    /// # Arguments
+    /// * `ttl` - Time-to-live duration for cache entries
+    /// * `max_entries` - Maximum number of entries before LRU eviction
+    pub fn with_capacity(ttl: Duration, max_entries: usize) -> Self {
+        let max_entries = max_entries.max(SHARD_COUNT);
+        let shards = (0..SHARD_COUNT)
+            .map(|_| RwLock::new(HashMap::new()))
+            .collect();
         Self {
-            entries: Arc::new(RwLock::new(HashMap::new())),
+            shards: Arc::new(shards),
             ttl,
+            max_per_shard: max_entries.div_ceil(SHARD_COUNT),
+            max_entries,
+            epoch: Instant::now(),
+            hits: Arc::new(AtomicU64::new(0)),
+            misses: Arc::new(AtomicU64::new(0)),
+            evictions: Arc::new(AtomicU64::new(0)),
         }
     }
 
+    /// Milliseconds elapsed since the cache was created
+    fn now_ms(&self) -> u64 {
+        self.epoch.elapsed().as_millis() as u64
+    }
+
+    /// Select the shard responsible for a key
+    fn shard(&self, key: &str) -> &Shard<T> {
+        let mut hasher = DefaultHasher::new();
+        key.hash(&mut hasher);
+        &self.shards[(hasher.finish() as usize) & (SHARD_COUNT - 1)]
+    }
+
     /// Get a value from the cache
     ///
     /// Returns None if:
@@ -80,34 +161,56 @@ impl<T: Clone> Cache<T> {
     /// # Returns
     /// The cached value if present and not expired, None otherwise
     pub async fn get(&self, key: &str) -> Option<T> {
-        let entries = self.entries.read().await;
-
-        if let Some(entry) = entries.get(key) {
-            if !entry.is_expired() {
-                return Some(entry.value.clone());
+        {
+            let entries = self.shard(key).read().await;
+            if let Some(entry) = entries.get(key) {
+                if !entry.is_expired() {
+                    entry.last_used.store(self.now_ms(), Ordering::Relaxed);
+                    self.hits.fetch_add(1, Ordering::Relaxed);
+                    return Some(entry.value.clone());
+                }
+                // Entry is expired, will be removed in cleanup
             }
-            // Entry is expired, will be removed in cleanup
         }
 
-        drop(entries);
-
         // Remove expired entry if found
         self.remove_if_expired(key).await;
 
+        self.misses.fetch_add(1, Ordering::Relaxed);
         None
     }
 
     /// Set a value in the cache
     ///
     /// Stores the value with the configured TTL. If a value already exists
-    /// for this key, it will be replaced.
+    /// for this key, it will be replaced. When the target shard is at
+    /// capacity, expired entries are dropped first and then the
+    /// least-recently-used entry is evicted.
     ///
     /// # Arguments
     /// * `key` - The cache key
     /// * `value` - The value to cache
     pub async fn set(&self, key: String, value: T) {
-        let mut entries = self.entries.write().await;
-        entries.insert(key, CacheEntry::new(value, self.ttl));
+        let now_ms = self.now_ms();
+        let mut entries = self.shard(&key).write().await;
+
+        if !entries.contains_key(&key) && entries.len() >= self.max_per_shard {
+            // Prefer dropping expired entries over evicting live ones
+            entries.retain(|_, entry| !entry.is_expired());
+
+            if entries.len() >= self.max_per_shard {
+                let lru_key = entries
+                    .iter()
+                    .min_by_key(|(_, entry)| entry.last_used.load(Ordering::Relaxed))
+                    .map(|(key, _)| key.clone());
+                if let Some(lru_key) = lru_key {
+                    entries.remove(&lru_key);
+                    self.evictions.fetch_add(1, Ordering::Relaxed);
+                }
+            }
+        }
+
+        entries.insert(key, CacheEntry::new(value, self.ttl, now_ms));
     }
 
     /// Invalidate (remove) a specific cache entry
@@ -121,7 +224,7 @@ impl<T: Clone> Cache<T> {
     /// # Returns
     /// true if an entry was removed, false if key didn't exist
     pub async fn invalidate(&self, key: &str) -> bool {
-        let mut entries = self.entries.write().await;
+        let mut entries = self.shard(key).write().await;
         entries.remove(key).is_some()
     }
 
@@ -130,15 +233,16 @@ impl<T: Clone> Cache<T> {
     /// This is useful when major structural changes occur (e.g., team changes)
     /// that may affect multiple cached entries.
     pub async fn clear(&self) {
-        let mut entries = self.entries.write().await;
-        entries.clear();
+        for shard in self.shards.iter() {
+            shard.write().await.clear();
+        }
     }
 
     /// Remove a key only if it's expired
     ///
     /// This is used internally for cleanup during get operations.
     async fn remove_if_expired(&self, key: &str) {
-        let mut entries = self.entries.write().await;
+        let mut entries = self.shard(key).write().await;
         if let Some(entry) = entries.get(key) {
             if entry.is_expired() {
                 entries.remove(key);
@@ -154,22 +258,14 @@ impl<T: Clone> Cache<T> {
     /// # Returns
     /// The number of entries removed
     pub async fn cleanup_expired(&self) -> usize {
-        let mut entries = self.entries.write().await;
-        let before_count = entries.len();
-
-        // Collect keys of expired entries
-        let expired_keys: Vec<String> = entries
-            .iter()
-            .filter(|(_, entry)| entry.is_expired())
-            .map(|(key, _)| key.clone())
-            .collect();
-
-        // Remove expired entries
-        for key in &expired_keys {
-            entries.remove(key);
+        let mut removed = 0;
+        for shard in self.shards.iter() {
+            let mut entries = shard.write().await;
+            let before_count = entries.len();
+            entries.retain(|_, entry| !entry.is_expired());
+            removed += before_count - entries.len();
         }
-
-        before_count - entries.len()
+        removed
     }
 
     /// Get the current number of cached entries
@@ -180,7 +276,11 @@ impl<T: Clone> Cache<T> {
     /// # Returns
     /// The number of entries currently in cache
     pub async fn len(&self) -> usize {
-        self.entries.read().await.len()
+        let mut total = 0;
+        for shard in self.shards.iter() {
+            total += shard.read().await.len();
+        }
+        total
     }
 
     /// Check if the cache is empty
@@ -188,7 +288,47 @@ impl<T: Clone> Cache<T> {
     /// # Returns
     /// true if the cache contains no entries
     pub async fn is_empty(&self) -> bool {
-        self.entries.read().await.is_empty()
+        self.len().await == 0
+    }
+
+    /// Export unexpired entries together with their remaining TTL
+    ///
+    /// Used for persisting the cache across process restarts. Expired
+    /// entries are skipped.
+    ///
+    /// # Returns
+    /// A Vec of (key, value, remaining TTL in milliseconds) tuples
+    pub async fn export_entries(&self) -> Vec<(String, T, u64)> {
+        let now = Instant::now();
+        let mut exported = Vec::new();
+        for shard in self.shards.iter() {
+            let entries = shard.read().await;
+            exported.extend(entries.iter().filter(|(_, entry)| !entry.is_expired()).map(
+                |(key, entry)| {
+                    let remaining_ms =
+                        entry.expires_at.saturating_duration_since(now).as_millis() as u64;
+                    (key.clone(), entry.value.clone(), remaining_ms)
+                },
+            ));
+        }
+        exported
+    }
+
+    /// Import entries with an explicit remaining TTL
+    ///
+    /// The counterpart of `export_entries` for loading a persisted cache.
+    /// Each entry's remaining TTL is capped at the cache's configured TTL so
+    /// a stale snapshot cannot extend entry lifetimes.
+    ///
+    /// # Arguments
+    /// * `entries` - (key, value, remaining TTL in milliseconds) tuples
+    pub async fn import_entries(&self, entries: Vec<(String, T, u64)>) {
+        for (key, value, remaining_ms) in entries {
+            let ttl = Duration::from_millis(remaining_ms).min(self.ttl);
+            let now_ms = self.now_ms();
+            let mut shard = self.shard(&key).write().await;
+            shard.insert(key, CacheEntry::new(value, ttl, now_ms));
+        }
     }
 
     /// Get cache statistics
@@ -196,11 +336,29 @@ impl<T: Clone> Cache<T> {
     /// # Returns
     /// A tuple of (total_entries, expired_entries)
     pub async fn stats(&self) -> (usize, usize) {
-        let entries = self.entries.read().await;
-        let total = entries.len();
-        let expired = entries.values().filter(|e| e.is_expired()).count();
+        let mut total = 0;
+        let mut expired = 0;
+        for shard in self.shards.iter() {
+            let entries = shard.read().await;
+            total += entries.len();
+            expired += entries.values().filter(|e| e.is_expired()).count();
+        }
         (total, expired)
     }
+
+    /// Get hit/miss/eviction statistics for this cache
+    ///
+    /// # Returns
+    /// A CacheStats snapshot of the counters and current size
+    pub async fn statistics(&self) -> CacheStats {
+        CacheStats {
+            hits: self.hits.load(Ordering::Relaxed),
+            misses: self.misses.load(Ordering::Relaxed),
+            evictions: self.evictions.load(Ordering::Relaxed),
+            entries: self.len().await,
+            max_entries: self.max_entries,
+        }
+    }
 }
 
 #[cfg(test)]
@@ -380,6 +538,46 @@ mod tests {
         }
     }
 
+    #[tokio::test]
+    async fn test_cache_export_import_roundtrip() {
+        let cache = Cache::new(Duration::from_secs(300));
+        cache.set("key1".to_string(), "value1".to_string()).await;
+        cache.set("key2".to_string(), "value2".to_string()).await;
+
+        let entries = cache.export_entries().await;
+        assert_eq!(entries.len(), 2);
+
+        let restored: Cache<String> = Cache::new(Duration::from_secs(300));
+        restored.import_entries(entries).await;
+        assert_eq!(restored.get("key1").await, Some("value1".to_string()));
+        assert_eq!(restored.get("key2").await, Some("value2".to_string()));
+    }
+
+    #[tokio::test]
+    async fn test_cache_export_skips_expired() {
+        let cache = Cache::new(Duration::from_millis(100));
+        cache.set("key1".to_string(), "value1".to_string()).await;
+
+        sleep(Duration::from_millis(150)).await;
+
+        let entries = cache.export_entries().await;
+        assert!(entries.is_empty());
+    }
+
+    #[tokio::test]
+    async fn test_cache_import_caps_ttl() {
+        // Imported remaining TTL longer than the cache TTL must be capped
+        let cache: Cache<String> = Cache::new(Duration::from_millis(100));
+        cache
+            .import_entries(vec![("key1".to_string(), "value1".to_string(), 60_000)])
+            .await;
+
+        assert_eq!(cache.get("key1").await, Some("value1".to_string()));
+
+        sleep(Duration::from_millis(150)).await;
+        assert_eq!(cache.get("key1").await, None);
+    }
+
     #[tokio::test]
     async fn test_cache_is_empty() {
         let cache: Cache<String> = Cache::new(Duration::from_secs(300));
@@ -392,4 +590,57 @@ mod tests {
         cache.clear().await;
         assert!(cache.is_empty().await);
     }
+
+    #[tokio::test]
+    async fn test_cache_bounded_eviction() {
+        // Capacity is rounded up to at least one entry per shard, so fill
+        // well past the bound and verify the size stays at or below it
+        let cache = Cache::with_capacity(Duration::from_secs(300), SHARD_COUNT);
+        for i in 0..100 {
+            cache.set(format!("key{}", i), format!("value{}", i)).await;
+        }
+
+        assert!(cache.len().await <= SHARD_COUNT);
+
+        let stats = cache.statistics().await;
+        assert!(stats.evictions > 0);
+    }
+
+    #[tokio::test]
+    async fn test_cache_lru_eviction_order() {
+        // One entry per shard: inserting a second key into the same shard
+        // must evict the first
+        let cache = Cache::with_capacity(Duration::from_secs(300), SHARD_COUNT);
+
+        cache.set("a".to_string(), "1".to_string()).await;
+        // Find another key landing in the same shard as "a"
+        let mut colliding = None;
+        for i in 0..1000 {
+            let candidate = format!("key{}", i);
+            if std::ptr::eq(cache.shard(&candidate), cache.shard("a")) {
+                colliding = Some(candidate);
+                break;
+            }
+        }
+        let colliding = colliding.expect("No colliding key found");
+
+        cache.set(colliding.clone(), "2".to_string()).await;
+        assert_eq!(cache.get(&colliding).await, Some("2".to_string()));
+        assert_eq!(cache.get("a").await, None);
+    }
+
+    #[tokio::test]
+    async fn test_cache_hit_miss_counters() {
+        let cache = Cache::new(Duration::from_secs(300));
+
+        cache.set("key1".to_string(), "value1".to_string()).await;
+        cache.get("key1").await;
+        cache.get("key1").await;
+        cache.get("missing").await;
+
+        let stats = cache.statistics().await;
+        assert_eq!(stats.hits, 2);
+        assert_eq!(stats.misses, 1);
+        assert_eq!(stats.entries, 1);
+    }
 }
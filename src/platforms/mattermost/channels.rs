@@ -59,6 +59,31 @@ impl MattermostClient {
         self.handle_response(response).await
     }
 
+    /// Get channels for the current user in a team, including recent deletions
+    ///
+    /// Includes channels archived after `since` (milliseconds since epoch)
+    /// so callers can compute a delta against local state. The server only
+    /// filters deletions by timestamp; update filtering happens client-side
+    /// on the `update_at` field.
+    ///
+    /// # Arguments
+    /// * `team_id` - The ID of the team to get channels from
+    /// * `since` - Only include channels deleted after this timestamp
+    ///
+    /// # Returns
+    /// A Result containing a list of channels or an Error
+    pub async fn get_channels_for_team_since(
+        &self,
+        team_id: &str,
+        since: i64,
+    ) -> Result<Vec<MattermostChannel>> {
+        let endpoint = format!(
+            "/users/me/teams/{team_id}/channels?include_deleted=true&last_delete_at={since}"
+        );
+        let response = self.get(&endpoint).await?;
+        self.handle_response(response).await
+    }
+
     /// Get a channel by ID
     ///
     /// # Arguments
@@ -140,6 +165,21 @@ impl MattermostClient {
         self.handle_response(response).await
     }
 
+    /// Get all members of a channel in the background scheduler lane
+    ///
+    /// Used by bulk fetches so they yield to interactive requests under
+    /// rate limiting.
+    pub async fn get_channel_members_background(
+        &self,
+        channel_id: &str,
+    ) -> Result<Vec<ChannelMember>> {
+        let endpoint = format!("/channels/{channel_id}/members");
+        let response = self
+            .get_with_priority(&endpoint, super::scheduler::RequestPriority::Background)
+            .await?;
+        self.handle_response(response).await
+    }
+
     /// Get a specific channel member
     ///
     /// # Arguments
@@ -1,13 +1,19 @@
+use lazy_static::lazy_static;
 use reqwest::Client;
+use std::collections::HashMap;
+use std::sync::atomic::{AtomicBool, Ordering};
 use std::sync::Arc;
+use std::sync::Mutex as StdMutex;
 use std::time::Duration;
-use tokio::sync::RwLock;
+use tokio::sync::{RwLock, Semaphore};
 use url::Url;
 
 use crate::error::{Error, ErrorCode, Result};
 use crate::types::{ConnectionInfo, ConnectionState};
 
-use super::cache::Cache;
+use super::cache::{Cache, CacheStats};
+use super::scheduler::{RateLimitScheduler, RequestPriority};
+use super::singleflight::SingleFlight;
 use super::types::{MattermostChannel, MattermostTeam, MattermostUser};
 
 /// Configuration for caching API responses
@@ -19,6 +25,12 @@ pub struct CacheConfig {
     pub channel_ttl: Duration,
     /// Time-to-live for team cache entries (default: 10 minutes)
     pub team_ttl: Duration,
+    /// Maximum number of user cache entries (default: 10000)
+    pub user_max_entries: usize,
+    /// Maximum number of channel cache entries (default: 5000)
+    pub channel_max_entries: usize,
+    /// Maximum number of team cache entries (default: 500)
+    pub team_max_entries: usize,
     /// Enable caching (default: true)
     pub enable_cache: bool,
 }
@@ -29,6 +41,9 @@ impl Default for CacheConfig {
             user_ttl: Duration::from_secs(300),    // 5 minutes
             channel_ttl: Duration::from_secs(120), // 2 minutes
             team_ttl: Duration::from_secs(600),    // 10 minutes
+            user_max_entries: 10_000,
+            channel_max_entries: 5_000,
+            team_max_entries: 500,
             enable_cache: true,
         }
     }
@@ -55,6 +70,48 @@ pub struct RateLimitInfo {
     pub reset_at: u64,
 }
 
+/// Maximum concurrent HTTP requests per client handle
+///
+/// Bounds how much of the shared connection pool a single handle can
+/// occupy, so in multi-tenant processes one busy workspace cannot starve
+/// the others.
+const MAX_IN_FLIGHT_PER_HANDLE: usize = 16;
+
+lazy_static! {
+    /// HTTP clients shared between handles pointing at the same server
+    ///
+    /// reqwest clients hold their connection pool behind an internal Arc,
+    /// so cloning one shares TCP/TLS connections and the DNS cache.
+    /// Processes hosting hundreds of handles for the same server reuse one
+    /// pool instead of opening per-handle connections.
+    static ref SHARED_HTTP_CLIENTS: StdMutex<HashMap<String, Client>> =
+        StdMutex::new(HashMap::new());
+}
+
+/// Get or create the shared HTTP client for a server base URL
+fn shared_http_client(base_url: &Url) -> Result<Client> {
+    let key = base_url.as_str().to_string();
+    let mut clients = SHARED_HTTP_CLIENTS
+        .lock()
+        .unwrap_or_else(|e| e.into_inner());
+
+    if let Some(client) = clients.get(&key) {
+        return Ok(client.clone());
+    }
+
+    let client = Client::builder()
+        .timeout(std::time::Duration::from_secs(30))
+        .build()
+        .map_err(|e| {
+            Error::new(
+                ErrorCode::NetworkError,
+                format!("Failed to create HTTP client: {e}"),
+            )
+        })?;
+    clients.insert(key, client.clone());
+    Ok(client)
+}
+
 /// Mattermost client for interacting with Mattermost servers
 pub struct MattermostClient {
     /// HTTP client for REST API calls
@@ -71,12 +128,23 @@ pub struct MattermostClient {
     user_id: Arc<RwLock<Option<String>>>,
     /// Rate limit information from last API response
     rate_limit_info: Arc<RwLock<Option<RateLimitInfo>>>,
+    /// Request scheduler pacing outgoing calls at the server's rate limit
+    scheduler: RateLimitScheduler,
+    /// Per-handle cap on concurrent HTTP requests (multi-tenant fairness)
+    in_flight: Arc<Semaphore>,
+    /// Whether responses may be served compressed (gzip/br/zstd)
+    compression_enabled: AtomicBool,
     /// Cache for user objects
-    user_cache: Cache<MattermostUser>,
+    pub(crate) user_cache: Cache<MattermostUser>,
     /// Cache for channel objects
-    channel_cache: Cache<MattermostChannel>,
+    pub(crate) channel_cache: Cache<MattermostChannel>,
     /// Cache for team objects
-    team_cache: Cache<MattermostTeam>,
+    pub(crate) team_cache: Cache<MattermostTeam>,
+    /// Single-flight groups so concurrent cache misses for the same key
+    /// share one HTTP request instead of each issuing their own
+    user_flight: SingleFlight<MattermostUser>,
+    channel_flight: SingleFlight<MattermostChannel>,
+    team_flight: SingleFlight<MattermostTeam>,
     /// Cache configuration
     cache_config: CacheConfig,
 }
@@ -105,15 +173,7 @@ impl MattermostClient {
         let base_url = Url::parse(base_url)
             .map_err(|e| Error::new(ErrorCode::InvalidArgument, format!("Invalid URL: {e}")))?;
 
-        let http_client = Client::builder()
-            .timeout(std::time::Duration::from_secs(30))
-            .build()
-            .map_err(|e| {
-                Error::new(
-                    ErrorCode::NetworkError,
-                    format!("Failed to create HTTP client: {e}"),
-                )
-            })?;
+        let http_client = shared_http_client(&base_url)?;
 
         Ok(Self {
             http_client,
@@ -123,9 +183,18 @@ impl MattermostClient {
             team_id: Arc::new(RwLock::new(None)),
             user_id: Arc::new(RwLock::new(None)),
             rate_limit_info: Arc::new(RwLock::new(None)),
-            user_cache: Cache::new(cache_config.user_ttl),
-            channel_cache: Cache::new(cache_config.channel_ttl),
-            team_cache: Cache::new(cache_config.team_ttl),
+            scheduler: RateLimitScheduler::new(),
+            in_flight: Arc::new(Semaphore::new(MAX_IN_FLIGHT_PER_HANDLE)),
+            compression_enabled: AtomicBool::new(true),
+            user_cache: Cache::with_capacity(cache_config.user_ttl, cache_config.user_max_entries),
+            channel_cache: Cache::with_capacity(
+                cache_config.channel_ttl,
+                cache_config.channel_max_entries,
+            ),
+            team_cache: Cache::with_capacity(cache_config.team_ttl, cache_config.team_max_entries),
+            user_flight: SingleFlight::new(),
+            channel_flight: SingleFlight::new(),
+            team_flight: SingleFlight::new(),
             cache_config,
         })
     }
@@ -252,6 +321,7 @@ impl MattermostClient {
     /// Update stored rate limit info from a response
     async fn update_rate_limit_info(&self, response: &reqwest::Response) {
         if let Some(info) = self.extract_rate_limit_info(response) {
+            self.scheduler.update(&info).await;
             let mut rate_limit = self.rate_limit_info.write().await;
             *rate_limit = Some(info);
         }
@@ -301,16 +371,73 @@ impl MattermostClient {
         format!("{base}/api/v4/{endpoint}")
     }
 
+    /// Take a slot from the per-handle in-flight request cap
+    ///
+    /// Held for the duration of one HTTP request; bounds how many
+    /// concurrent requests a single handle can keep in the shared
+    /// connection pool.
+    async fn acquire_request_slot(&self) -> Result<tokio::sync::SemaphorePermit<'_>> {
+        self.in_flight
+            .acquire()
+            .await
+            .map_err(|_| Error::new(ErrorCode::InvalidState, "Request limiter closed"))
+    }
+
+    /// Enable or disable negotiated response compression
+    ///
+    /// Enabled by default: the HTTP client advertises gzip/br/zstd and
+    /// decompresses transparently as the body streams in. When disabled,
+    /// requests ask for identity encoding explicitly, overriding the
+    /// client's automatic Accept-Encoding header.
+    pub fn set_compression(&self, enabled: bool) {
+        self.compression_enabled.store(enabled, Ordering::Relaxed);
+    }
+
+    /// Apply the compression preference to an outgoing request
+    pub(crate) fn apply_encoding(
+        &self,
+        request: reqwest::RequestBuilder,
+    ) -> reqwest::RequestBuilder {
+        if self.compression_enabled.load(Ordering::Relaxed) {
+            request
+        } else {
+            request.header(reqwest::header::ACCEPT_ENCODING, "identity")
+        }
+    }
+
     /// Make a GET request to the Mattermost API
     ///
+    /// Paced by the rate limit scheduler in the interactive lane; bulk
+    /// callers should use get_with_priority with RequestPriority::Background.
+    ///
     /// # Arguments
     /// * `endpoint` - The API endpoint path
     ///
     /// # Returns
     /// A Result containing the reqwest::Response or an Error
     pub async fn get(&self, endpoint: &str) -> Result<reqwest::Response> {
+        self.get_with_priority(endpoint, RequestPriority::Interactive)
+            .await
+    }
+
+    /// Make a GET request in a specific priority lane
+    ///
+    /// # Arguments
+    /// * `endpoint` - The API endpoint path
+    /// * `priority` - Which scheduler lane the request runs in
+    ///
+    /// # Returns
+    /// A Result containing the reqwest::Response or an Error
+    pub async fn get_with_priority(
+        &self,
+        endpoint: &str,
+        priority: RequestPriority,
+    ) -> Result<reqwest::Response> {
+        self.scheduler.acquire(priority).await;
+        let _slot = self.acquire_request_slot().await?;
+
         let url = self.api_url(endpoint);
-        let mut request = self.http_client.get(&url);
+        let mut request = self.apply_encoding(self.http_client.get(&url));
 
         if let Some(token) = self.get_token().await {
             request = request.bearer_auth(token);
@@ -335,8 +462,30 @@ impl MattermostClient {
         endpoint: &str,
         body: &T,
     ) -> Result<reqwest::Response> {
+        self.post_with_priority(endpoint, body, RequestPriority::Interactive)
+            .await
+    }
+
+    /// Make a POST request in a specific priority lane
+    ///
+    /// # Arguments
+    /// * `endpoint` - The API endpoint path
+    /// * `body` - The request body (will be serialized to JSON)
+    /// * `priority` - Which scheduler lane the request runs in
+    ///
+    /// # Returns
+    /// A Result containing the reqwest::Response or an Error
+    pub async fn post_with_priority<T: serde::Serialize>(
+        &self,
+        endpoint: &str,
+        body: &T,
+        priority: RequestPriority,
+    ) -> Result<reqwest::Response> {
+        self.scheduler.acquire(priority).await;
+        let _slot = self.acquire_request_slot().await?;
+
         let url = self.api_url(endpoint);
-        let mut request = self.http_client.post(&url);
+        let mut request = self.apply_encoding(self.http_client.post(&url));
 
         if let Some(token) = self.get_token().await {
             request = request.bearer_auth(token);
@@ -362,8 +511,11 @@ impl MattermostClient {
         endpoint: &str,
         body: &T,
     ) -> Result<reqwest::Response> {
+        self.scheduler.acquire(RequestPriority::Interactive).await;
+        let _slot = self.acquire_request_slot().await?;
+
         let url = self.api_url(endpoint);
-        let mut request = self.http_client.put(&url);
+        let mut request = self.apply_encoding(self.http_client.put(&url));
 
         if let Some(token) = self.get_token().await {
             request = request.bearer_auth(token);
@@ -384,8 +536,11 @@ impl MattermostClient {
     /// # Returns
     /// A Result containing the reqwest::Response or an Error
     pub async fn delete(&self, endpoint: &str) -> Result<reqwest::Response> {
+        self.scheduler.acquire(RequestPriority::Interactive).await;
+        let _slot = self.acquire_request_slot().await?;
+
         let url = self.api_url(endpoint);
-        let mut request = self.http_client.delete(&url);
+        let mut request = self.apply_encoding(self.http_client.delete(&url));
 
         if let Some(token) = self.get_token().await {
             request = request.bearer_auth(token);
@@ -579,13 +734,15 @@ impl MattermostClient {
             return Ok(user);
         }
 
-        // Cache miss - fetch from API
-        let user = self.get_user(user_id).await?;
-
-        // Store in cache before returning
-        self.user_cache.set(user_id.to_string(), user.clone()).await;
-
-        Ok(user)
+        // Cache miss - fetch from API, sharing one request among concurrent
+        // callers for the same user
+        self.user_flight
+            .run(user_id, || async {
+                let user = self.get_user(user_id).await?;
+                self.user_cache.set(user_id.to_string(), user.clone()).await;
+                Ok(user)
+            })
+            .await
     }
 
     /// Get a channel by ID with caching
@@ -609,15 +766,17 @@ impl MattermostClient {
             return Ok(channel);
         }
 
-        // Cache miss - fetch from API
-        let channel = self.get_channel(channel_id).await?;
-
-        // Store in cache before returning
-        self.channel_cache
-            .set(channel_id.to_string(), channel.clone())
-            .await;
-
-        Ok(channel)
+        // Cache miss - fetch from API, sharing one request among concurrent
+        // callers for the same channel
+        self.channel_flight
+            .run(channel_id, || async {
+                let channel = self.get_channel(channel_id).await?;
+                self.channel_cache
+                    .set(channel_id.to_string(), channel.clone())
+                    .await;
+                Ok(channel)
+            })
+            .await
     }
 
     /// Get a team by ID with caching
@@ -641,13 +800,15 @@ impl MattermostClient {
             return Ok(team);
         }
 
-        // Cache miss - fetch from API
-        let team = self.get_team(team_id).await?;
-
-        // Store in cache before returning
-        self.team_cache.set(team_id.to_string(), team.clone()).await;
-
-        Ok(team)
+        // Cache miss - fetch from API, sharing one request among concurrent
+        // callers for the same team
+        self.team_flight
+            .run(team_id, || async {
+                let team = self.get_team(team_id).await?;
+                self.team_cache.set(team_id.to_string(), team.clone()).await;
+                Ok(team)
+            })
+            .await
     }
 
     /// Get multiple users by their IDs with caching
@@ -802,6 +963,20 @@ impl MattermostClient {
             ),
         ]
     }
+
+    /// Get hit/miss/eviction statistics for all caches
+    ///
+    /// Returns per-cache counters: (cache_name, statistics)
+    ///
+    /// # Returns
+    /// A vector of tuples containing cache statistics
+    pub async fn cache_statistics(&self) -> Vec<(&'static str, CacheStats)> {
+        vec![
+            ("users", self.user_cache.statistics().await),
+            ("channels", self.channel_cache.statistics().await),
+            ("teams", self.team_cache.statistics().await),
+        ]
+    }
 }
 
 #[cfg(test)]
@@ -820,6 +995,47 @@ mod tests {
         assert!(client.is_err());
     }
 
+    #[test]
+    fn test_shared_http_client_per_server() {
+        let url = Url::parse("https://shared-pool.example.com").unwrap();
+
+        let _first = shared_http_client(&url).unwrap();
+        let entries_after_first = SHARED_HTTP_CLIENTS.lock().unwrap().len();
+
+        // A second handle for the same server reuses the pooled client
+        let _second = shared_http_client(&url).unwrap();
+        let entries_after_second = SHARED_HTTP_CLIENTS.lock().unwrap().len();
+        assert_eq!(entries_after_first, entries_after_second);
+
+        // A different server gets its own pool
+        let other = Url::parse("https://other-pool.example.com").unwrap();
+        let _third = shared_http_client(&other).unwrap();
+        assert_eq!(
+            SHARED_HTTP_CLIENTS.lock().unwrap().len(),
+            entries_after_second + 1
+        );
+    }
+
+    #[tokio::test]
+    async fn test_in_flight_cap() {
+        let client = MattermostClient::new("https://mattermost.example.com").unwrap();
+
+        // Drain all slots, then verify the next acquire has to wait
+        let mut permits = Vec::new();
+        for _ in 0..MAX_IN_FLIGHT_PER_HANDLE {
+            permits.push(client.acquire_request_slot().await.unwrap());
+        }
+
+        tokio::select! {
+            _ = client.acquire_request_slot() => panic!("cap exceeded"),
+            _ = tokio::time::sleep(Duration::from_millis(20)) => {}
+        }
+
+        // Releasing a slot unblocks the next request
+        permits.pop();
+        let _permit = client.acquire_request_slot().await.unwrap();
+    }
+
     #[test]
     fn test_api_url() {
         let client = MattermostClient::new("https://mattermost.example.com").unwrap();
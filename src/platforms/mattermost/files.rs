@@ -88,7 +88,7 @@ impl MattermostClient {
 
         // Send the request
         let url = self.api_url("/files");
-        let mut request = self.http_client.post(&url);
+        let mut request = self.apply_encoding(self.http_client.post(&url));
 
         if let Some(token) = self.get_token().await {
             request = request.bearer_auth(token);
@@ -117,6 +117,119 @@ impl MattermostClient {
             .ok_or_else(|| Error::new(ErrorCode::Unknown, "No file info returned from upload"))
     }
 
+    /// Upload a file to a channel, streaming it from disk in bounded chunks
+    ///
+    /// Unlike `upload_file`, the file is never read into memory in full: the
+    /// request body is streamed from disk one chunk at a time, so memory
+    /// usage stays constant regardless of file size. The progress handler is
+    /// invoked after each chunk is handed to the transport with the bytes
+    /// read so far and the total file size.
+    ///
+    /// # Arguments
+    /// * `channel_id` - The channel ID where the file will be uploaded
+    /// * `file_path` - Path to the file to upload
+    /// * `client_id` - Optional client ID for tracking the upload
+    /// * `progress` - Optional handler invoked as the upload makes progress
+    ///
+    /// # Returns
+    /// A Result containing the FileInfo metadata for the uploaded file
+    pub async fn upload_file_streaming(
+        &self,
+        channel_id: &str,
+        file_path: &Path,
+        client_id: Option<&str>,
+        progress: Option<crate::platforms::ProgressHandler>,
+    ) -> Result<FileInfo> {
+        use tokio::io::AsyncReadExt;
+
+        /// Chunk size for streaming uploads (64 KiB)
+        const UPLOAD_CHUNK_SIZE: usize = 64 * 1024;
+
+        let file = tokio::fs::File::open(file_path).await.map_err(|e| {
+            Error::new(
+                ErrorCode::InvalidArgument,
+                format!("Failed to open file: {e}"),
+            )
+        })?;
+
+        let total_size = file
+            .metadata()
+            .await
+            .map_err(|e| {
+                Error::new(
+                    ErrorCode::InvalidArgument,
+                    format!("Failed to read file metadata: {e}"),
+                )
+            })?
+            .len();
+
+        let filename = file_path
+            .file_name()
+            .and_then(|n| n.to_str())
+            .ok_or_else(|| Error::new(ErrorCode::InvalidArgument, "Invalid file path"))?;
+
+        // Yield the file contents one bounded chunk at a time, reporting
+        // progress as each chunk is handed to the transport
+        let stream = futures::stream::unfold(
+            (file, 0u64, progress),
+            move |(mut file, sent, mut progress)| async move {
+                let mut buf = vec![0u8; UPLOAD_CHUNK_SIZE];
+                match file.read(&mut buf).await {
+                    Ok(0) => None,
+                    Ok(n) => {
+                        buf.truncate(n);
+                        let sent = sent + n as u64;
+                        if let Some(handler) = progress.as_mut() {
+                            handler(sent, total_size);
+                        }
+                        Some((Ok::<_, std::io::Error>(buf), (file, sent, progress)))
+                    }
+                    Err(e) => Some((Err(e), (file, sent, progress))),
+                }
+            },
+        );
+
+        let body = reqwest::Body::wrap_stream(stream);
+        let file_part =
+            multipart::Part::stream_with_length(body, total_size).file_name(filename.to_string());
+
+        let mut form = multipart::Form::new()
+            .text("channel_id", channel_id.to_string())
+            .part("files", file_part);
+
+        if let Some(cid) = client_id {
+            form = form.text("client_ids", cid.to_string());
+        }
+
+        let url = self.api_url("/files");
+        let mut request = self.apply_encoding(self.http_client.post(&url));
+
+        if let Some(token) = self.get_token().await {
+            request = request.bearer_auth(token);
+        }
+
+        let response = request
+            .multipart(form)
+            .send()
+            .await
+            .map_err(|e| Error::new(ErrorCode::NetworkError, format!("Upload failed: {e}")))?;
+
+        #[derive(serde::Deserialize)]
+        struct UploadResponse {
+            file_infos: Vec<FileInfo>,
+            #[allow(dead_code)]
+            client_ids: Option<Vec<String>>,
+        }
+
+        let upload_response: UploadResponse = self.handle_response(response).await?;
+
+        upload_response
+            .file_infos
+            .into_iter()
+            .next()
+            .ok_or_else(|| Error::new(ErrorCode::Unknown, "No file info returned from upload"))
+    }
+
     /// Download a file by its ID
     ///
     /// # Arguments
@@ -159,6 +272,55 @@ impl MattermostClient {
         })
     }
 
+    /// Download a file by its ID, delivering the body in chunks
+    ///
+    /// Unlike `download_file`, the body is never buffered in full: each chunk
+    /// is handed to the handler as it arrives from the network, so memory
+    /// usage stays constant regardless of file size.
+    ///
+    /// # Arguments
+    /// * `file_id` - The ID of the file to download
+    /// * `handler` - Invoked with each chunk; return false to cancel
+    ///
+    /// # Returns
+    /// Ok(()) once the whole file has been delivered
+    pub async fn download_file_streaming(
+        &self,
+        file_id: &str,
+        mut handler: crate::platforms::ChunkHandler,
+    ) -> Result<()> {
+        let endpoint = format!("/files/{file_id}");
+        let mut response = self.get(&endpoint).await?;
+
+        let status = response.status();
+        if !status.is_success() {
+            let error_text = response
+                .text()
+                .await
+                .unwrap_or_else(|_| "Unknown error".to_string());
+            return Err(Error::new(
+                ErrorCode::NetworkError,
+                format!("Failed to download file: {error_text}"),
+            ));
+        }
+
+        while let Some(chunk) = response.chunk().await.map_err(|e| {
+            Error::new(
+                ErrorCode::NetworkError,
+                format!("Failed to read file data: {e}"),
+            )
+        })? {
+            if !handler(&chunk) {
+                return Err(Error::new(
+                    ErrorCode::Unknown,
+                    "Download cancelled by chunk handler",
+                ));
+            }
+        }
+
+        Ok(())
+    }
+
     /// Get file metadata without downloading the file
     ///
     /// # Arguments
@@ -195,6 +357,13 @@ impl MattermostClient {
     /// Thumbnails are only available for image and video files.
     /// Returns an error if the file doesn't have a thumbnail.
     pub async fn get_file_thumbnail(&self, file_id: &str) -> Result<Vec<u8>> {
+        // Thumbnails are immutable for a given file ID, so a disk cache
+        // hit skips the network entirely
+        let cache_key = format!("thumbnail-{file_id}");
+        if let Some(bytes) = crate::file_cache::get(&cache_key) {
+            return Ok(bytes);
+        }
+
         let endpoint = format!("/files/{file_id}/thumbnail");
         let response = self.get(&endpoint).await?;
 
@@ -210,12 +379,14 @@ impl MattermostClient {
             ));
         }
 
-        response.bytes().await.map(|b| b.to_vec()).map_err(|e| {
+        let bytes = response.bytes().await.map(|b| b.to_vec()).map_err(|e| {
             Error::new(
                 ErrorCode::NetworkError,
                 format!("Failed to read thumbnail data: {e}"),
             )
-        })
+        })?;
+        crate::file_cache::put(&cache_key, &bytes);
+        Ok(bytes)
     }
 
     /// Download a file preview by its ID
@@ -230,6 +401,11 @@ impl MattermostClient {
     /// Previews are larger than thumbnails but smaller than the original file.
     /// Available for image and video files.
     pub async fn get_file_preview(&self, file_id: &str) -> Result<Vec<u8>> {
+        let cache_key = format!("preview-{file_id}");
+        if let Some(bytes) = crate::file_cache::get(&cache_key) {
+            return Ok(bytes);
+        }
+
         let endpoint = format!("/files/{file_id}/preview");
         let response = self.get(&endpoint).await?;
 
@@ -245,12 +421,14 @@ impl MattermostClient {
             ));
         }
 
-        response.bytes().await.map(|b| b.to_vec()).map_err(|e| {
+        let bytes = response.bytes().await.map(|b| b.to_vec()).map_err(|e| {
             Error::new(
                 ErrorCode::NetworkError,
                 format!("Failed to read preview data: {e}"),
             )
-        })
+        })?;
+        crate::file_cache::put(&cache_key, &bytes);
+        Ok(bytes)
     }
 
     /// Get a public link for a file
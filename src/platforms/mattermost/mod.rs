@@ -5,17 +5,22 @@
 //! `api-spec.yaml` in this directory.
 
 mod auth;
+mod batch;
 mod cache;
 mod channels;
 mod client;
 mod convert;
 mod files;
+mod outbox;
 mod pinned;
 mod platform_impl;
 mod posts;
 mod preferences;
 mod reactions;
+mod scheduler;
 mod search;
+mod singleflight;
+mod snapshot;
 mod status;
 mod teams;
 mod threads;
@@ -27,6 +32,7 @@ pub use cache::Cache;
 pub use client::{MattermostClient, RateLimitInfo};
 pub use convert::{status_string_to_user_status, user_status_to_status_string};
 pub use platform_impl::MattermostPlatform;
+pub use scheduler::{RateLimitScheduler, RequestPriority};
 pub use search::{
     ChannelSearchRequest, FileSearchRequest, FileSearchResponse, FileSearchResult,
     PostSearchOptions, UserSearchRequest,
@@ -0,0 +1,166 @@
+//! Background outbound message queue with retry and per-channel ordering
+//!
+//! Fire-and-forget senders (alerting bridges, bots) need a failed send to
+//! be the library's problem, not the caller's: enqueue returns
+//! immediately, and a background worker per channel delivers messages in
+//! order, retrying transient failures with exponential backoff. Requests
+//! still go through the HTTP client's rate limit scheduler, so retries
+//! honor the server's X-Ratelimit-* pacing like every other call.
+//! Messages that exhaust their retries (or fail non-transiently) are
+//! reported through the registered failure callback and dropped, keeping
+//! the channel's remaining messages flowing.
+
+use std::collections::HashMap;
+use std::sync::Arc;
+use tokio::sync::{mpsc, Mutex, RwLock};
+
+use crate::error::ErrorCode;
+use crate::error::{Error, Result};
+use crate::platforms::platform_trait::SendFailureCallback;
+
+use super::client::MattermostClient;
+
+/// Per-channel queue capacity; enqueue fails once a channel falls this
+/// far behind rather than buffering without bound
+const CHANNEL_QUEUE_SIZE: usize = 256;
+
+/// Maximum delivery attempts per message, including the first
+const MAX_SEND_ATTEMPTS: u32 = 5;
+
+/// Base delay before the first retry; doubles per attempt
+const RETRY_BASE_DELAY_MS: u64 = 500;
+
+/// Upper bound on the retry delay
+const RETRY_MAX_DELAY_MS: u64 = 30_000;
+
+/// Outbound message queue over the shared HTTP client
+///
+/// One worker task per destination channel preserves send order within a
+/// channel while different channels deliver concurrently. Workers are
+/// spawned lazily on first enqueue and exit when the outbox (and with it
+/// their queue's sender) is dropped.
+pub(crate) struct Outbox {
+    client: Arc<MattermostClient>,
+    /// Per-channel queue senders, created on first enqueue
+    queues: Mutex<HashMap<String, mpsc::Sender<String>>>,
+    /// Callback invoked when a message terminally fails
+    on_failure: Arc<RwLock<Option<SendFailureCallback>>>,
+}
+
+impl Outbox {
+    /// Create an outbox delivering through the given client
+    pub(crate) fn new(client: Arc<MattermostClient>) -> Self {
+        Self {
+            client,
+            queues: Mutex::new(HashMap::new()),
+            on_failure: Arc::new(RwLock::new(None)),
+        }
+    }
+
+    /// Register (or clear) the terminal failure callback
+    pub(crate) async fn set_failure_callback(&self, callback: Option<SendFailureCallback>) {
+        *self.on_failure.write().await = callback;
+    }
+
+    /// Enqueue a message for background delivery
+    ///
+    /// Returns as soon as the message is queued. Fails with
+    /// `InvalidState` when the channel's queue is full - sustained
+    /// overload needs backpressure, not an unbounded buffer.
+    pub(crate) async fn enqueue(&self, channel_id: &str, text: &str) -> Result<()> {
+        let mut queues = self.queues.lock().await;
+        let tx = match queues.get(channel_id) {
+            Some(tx) => tx,
+            None => {
+                let (tx, rx) = mpsc::channel::<String>(CHANNEL_QUEUE_SIZE);
+                tokio::spawn(Self::run_worker(
+                    Arc::clone(&self.client),
+                    channel_id.to_string(),
+                    rx,
+                    Arc::clone(&self.on_failure),
+                ));
+                queues.entry(channel_id.to_string()).or_insert(tx)
+            }
+        };
+
+        tx.try_send(text.to_string()).map_err(|_| {
+            Error::new(
+                ErrorCode::InvalidState,
+                format!("Outbound queue full for channel {channel_id}"),
+            )
+        })
+    }
+
+    /// Deliver one channel's messages in order, retrying transient errors
+    async fn run_worker(
+        client: Arc<MattermostClient>,
+        channel_id: String,
+        mut rx: mpsc::Receiver<String>,
+        on_failure: Arc<RwLock<Option<SendFailureCallback>>>,
+    ) {
+        while let Some(text) = rx.recv().await {
+            let mut attempt: u32 = 1;
+            loop {
+                match client.send_message(&channel_id, &text).await {
+                    Ok(_) => break,
+                    Err(e) if attempt < MAX_SEND_ATTEMPTS && is_transient(&e) => {
+                        tokio::time::sleep(std::time::Duration::from_millis(retry_delay_ms(
+                            attempt,
+                        )))
+                        .await;
+                        attempt += 1;
+                    }
+                    Err(e) => {
+                        if let Some(callback) = on_failure.read().await.as_ref() {
+                            callback(&channel_id, &text, &e);
+                        }
+                        break;
+                    }
+                }
+            }
+        }
+    }
+}
+
+/// Whether an error is worth retrying
+///
+/// Network blips and rate limiting clear up on their own; anything else
+/// (bad channel, permissions, auth) will fail identically on retry.
+fn is_transient(error: &Error) -> bool {
+    matches!(
+        error.code,
+        ErrorCode::NetworkError | ErrorCode::RateLimited | ErrorCode::Timeout
+    )
+}
+
+/// Exponential backoff delay for a retry attempt (1-based), capped
+fn retry_delay_ms(attempt: u32) -> u64 {
+    RETRY_BASE_DELAY_MS
+        .saturating_mul(1u64 << (attempt - 1).min(63))
+        .min(RETRY_MAX_DELAY_MS)
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    #[test]
+    fn test_retry_delay_backoff_and_cap() {
+        assert_eq!(retry_delay_ms(1), 500);
+        assert_eq!(retry_delay_ms(2), 1000);
+        assert_eq!(retry_delay_ms(3), 2000);
+        assert_eq!(retry_delay_ms(10), RETRY_MAX_DELAY_MS);
+    }
+
+    #[test]
+    fn test_transient_classification() {
+        assert!(is_transient(&Error::new(ErrorCode::NetworkError, "blip")));
+        assert!(is_transient(&Error::new(ErrorCode::RateLimited, "429")));
+        assert!(is_transient(&Error::new(ErrorCode::Timeout, "slow")));
+        assert!(!is_transient(&Error::new(ErrorCode::NotFound, "gone")));
+        assert!(!is_transient(&Error::new(
+            ErrorCode::PermissionDenied,
+            "no"
+        )));
+    }
+}
@@ -1,22 +1,38 @@
 use async_trait::async_trait;
+use std::collections::HashMap;
 use std::sync::Arc;
-use tokio::sync::Mutex;
+use tokio::sync::{Mutex, RwLock};
 
 use crate::error::{Error, ErrorCode, Result};
-use crate::platforms::platform_trait::{Platform, PlatformConfig, PlatformEvent};
+use crate::platforms::platform_trait::{
+    EventCallback, OverflowPolicy, Platform, PlatformConfig, PlatformEvent,
+};
 use crate::types::{
-    Attachment, Channel, ConnectionInfo, Message, PlatformCapabilities, Team, User,
+    Attachment, Channel, ChannelSyncDelta, ConnectionInfo, Message, PlatformCapabilities, Team,
+    User,
 };
 
 use super::client::MattermostClient;
 use super::convert::ConversionContext;
-use super::websocket::WebSocketManager;
+use super::outbox::Outbox;
+use super::websocket::{EventFilter, ReplayHook, WebSocketManager, WsMetrics};
 
 /// Wrapper struct that implements the Platform trait for Mattermost
 pub struct MattermostPlatform {
-    client: MattermostClient,
+    client: Arc<MattermostClient>,
+    /// Background outbound message queue (workers spawned lazily)
+    outbox: Outbox,
     connection_info: Option<ConnectionInfo>,
     websocket: Arc<Mutex<Option<WebSocketManager>>>,
+    event_callback: Option<EventCallback>,
+    event_filter: Option<EventFilter>,
+    overflow_policy: Option<OverflowPolicy>,
+    ws_metrics: Arc<WsMetrics>,
+    /// Live user status map, hydrated on subscribe and kept current from
+    /// status push events
+    status_map: Arc<RwLock<HashMap<String, crate::types::user::UserStatus>>>,
+    /// High-water timestamp (ms since epoch) of the last channel delta sync
+    channels_synced_at: i64,
     server_url: String,
     capabilities: PlatformCapabilities,
 }
@@ -24,11 +40,18 @@ pub struct MattermostPlatform {
 impl MattermostPlatform {
     /// Create a new Mattermost platform instance
     pub fn new(server_url: &str) -> Result<Self> {
-        let client = MattermostClient::new(server_url)?;
+        let client = Arc::new(MattermostClient::new(server_url)?);
         Ok(Self {
+            outbox: Outbox::new(Arc::clone(&client)),
             client,
             connection_info: None,
             websocket: Arc::new(Mutex::new(None)),
+            event_callback: None,
+            event_filter: None,
+            overflow_policy: None,
+            ws_metrics: Arc::new(WsMetrics::default()),
+            status_map: Arc::new(RwLock::new(HashMap::new())),
+            channels_synced_at: 0,
             server_url: server_url.to_string(),
             capabilities: PlatformCapabilities::mattermost(),
         })
@@ -39,6 +62,42 @@ impl MattermostPlatform {
         &self.client
     }
 
+    /// Fetch events missed while the WebSocket was disconnected
+    ///
+    /// Pulls posts-since for every channel on the current team and converts
+    /// them into message events ordered by creation time. Channels that
+    /// fail to fetch are skipped: replay is best-effort recovery and an
+    /// error here must not wedge the reconnect.
+    async fn collect_missed_events(client: &MattermostClient, since: i64) -> Vec<PlatformEvent> {
+        let Some(team_id) = client.get_team_id().await else {
+            return Vec::new();
+        };
+        let Ok(channels) = client.get_channels_for_team(&team_id).await else {
+            return Vec::new();
+        };
+
+        let mut posts: Vec<super::types::MattermostPost> = Vec::new();
+        for channel in &channels {
+            if let Ok(post_list) = client.get_posts_since(&channel.id, since).await {
+                posts.extend(post_list.posts.into_values());
+            }
+        }
+
+        posts.sort_by_key(|p| p.create_at);
+        posts
+            .into_iter()
+            .map(|p| {
+                // Posts-since also returns posts edited during the gap;
+                // surface those as updates rather than duplicates
+                if p.create_at > since {
+                    PlatformEvent::MessagePosted(p.into())
+                } else {
+                    PlatformEvent::MessageUpdated(p.into())
+                }
+            })
+            .collect()
+    }
+
     /// Convert a Mattermost channel to our Channel type with proper DM/GM handling
     async fn convert_channel_with_context(
         &self,
@@ -144,6 +203,12 @@ impl Platform for MattermostPlatform {
             self.client.set_team_id(Some(team_id)).await;
         }
 
+        // Optional response compression toggle (enabled by default);
+        // thin links keep it on, debugging proxies may want it off
+        if let Some(value) = config.extra.get("compression") {
+            self.client.set_compression(value != "false");
+        }
+
         // Get the current user to build connection info
         let current_user = self.client.get_current_user().await?;
 
@@ -179,6 +244,18 @@ impl Platform for MattermostPlatform {
         Ok(mm_post.into())
     }
 
+    async fn enqueue_message(&self, channel_id: &str, text: &str) -> Result<()> {
+        self.outbox.enqueue(channel_id, text).await
+    }
+
+    async fn set_send_failure_callback(
+        &mut self,
+        callback: Option<crate::platforms::platform_trait::SendFailureCallback>,
+    ) -> Result<()> {
+        self.outbox.set_failure_callback(callback).await;
+        Ok(())
+    }
+
     async fn get_channels(&self) -> Result<Vec<Channel>> {
         // Get team ID from connection info or client state
         let team_id = self.client.get_team_id().await.ok_or_else(|| {
@@ -205,6 +282,69 @@ impl Platform for MattermostPlatform {
         Ok(channels)
     }
 
+    async fn sync_channels_since(&mut self, since: i64) -> Result<ChannelSyncDelta> {
+        let team_id = self.client.get_team_id().await.ok_or_else(|| {
+            Error::new(
+                ErrorCode::InvalidState,
+                "Team ID not set - call connect() with a team_id or set it manually",
+            )
+        })?;
+
+        // A negative timestamp means "continue from the previous sync"
+        let since = if since < 0 {
+            self.channels_synced_at
+        } else {
+            since
+        };
+
+        let mm_channels = self
+            .client
+            .get_channels_for_team_since(&team_id, since)
+            .await?;
+
+        let current_user_id = self.client.get_user_id().await;
+
+        let mut created = Vec::new();
+        let mut updated = Vec::new();
+        let mut deleted_ids = Vec::new();
+        let mut high_water = since;
+
+        for mm_channel in mm_channels {
+            high_water = high_water
+                .max(mm_channel.update_at)
+                .max(mm_channel.delete_at);
+
+            if mm_channel.delete_at > since {
+                deleted_ids.push(mm_channel.id);
+                continue;
+            }
+            // The server only filters deletions by timestamp; drop channels
+            // that did not change since the sync point here
+            if mm_channel.update_at <= since || mm_channel.delete_at > 0 {
+                continue;
+            }
+
+            let is_new = mm_channel.create_at > since;
+            let channel = self
+                .convert_channel_with_context(mm_channel, current_user_id.as_deref())
+                .await?;
+            if is_new {
+                created.push(channel);
+            } else {
+                updated.push(channel);
+            }
+        }
+
+        self.channels_synced_at = high_water;
+
+        Ok(ChannelSyncDelta {
+            created,
+            updated,
+            deleted_ids,
+            synced_at: high_water,
+        })
+    }
+
     async fn get_channel(&self, channel_id: &str) -> Result<Channel> {
         let mm_channel = self.client.get_channel_cached(channel_id).await?;
         let current_user_id = self.client.get_user_id().await;
@@ -229,6 +369,12 @@ impl Platform for MattermostPlatform {
         // Reverse to get most recent first
         messages.reverse();
 
+        // Feed the local message index so fetched history becomes
+        // searchable offline (a no-op unless configured)
+        for message in &messages {
+            crate::message_index::ingest(message);
+        }
+
         Ok(messages)
     }
 
@@ -247,6 +393,43 @@ impl Platform for MattermostPlatform {
         Ok(mm_users.into_iter().map(|u| u.into()).collect())
     }
 
+    async fn get_channel_members_bulk(&self, channel_ids: Vec<String>) -> Result<String> {
+        let results = super::batch::execute_bulk(
+            channel_ids,
+            super::batch::DEFAULT_BULK_CONCURRENCY,
+            |channel_id| async move {
+                // Background scheduler lane: the bulk fan-out must not
+                // starve interactive requests under rate limiting
+                let mm_members = self
+                    .client
+                    .get_channel_members_background(&channel_id)
+                    .await?;
+                let user_ids: Vec<String> = mm_members.iter().map(|m| m.user_id.clone()).collect();
+                let mm_users = self.client.get_users_by_ids_cached(&user_ids).await?;
+                Ok(mm_users.into_iter().map(User::from).collect::<Vec<User>>())
+            },
+        )
+        .await;
+
+        let mut aggregated = serde_json::Map::new();
+        for (channel_id, result) in results {
+            let value = match result {
+                Ok(members) => serde_json::json!({ "members": members }),
+                Err(e) => serde_json::json!({
+                    "error": { "code": e.code as i32, "message": e.message }
+                }),
+            };
+            aggregated.insert(channel_id, value);
+        }
+
+        serde_json::to_string(&serde_json::Value::Object(aggregated)).map_err(|e| {
+            Error::new(
+                ErrorCode::Unknown,
+                format!("Failed to serialize bulk member results: {e}"),
+            )
+        })
+    }
+
     async fn get_user(&self, user_id: &str) -> Result<User> {
         let mm_user = self.client.get_user_cached(user_id).await?;
         Ok(mm_user.into())
@@ -310,6 +493,52 @@ impl Platform for MattermostPlatform {
         Ok(mm_team.into())
     }
 
+    async fn bootstrap(&self, include_members: bool) -> Result<crate::types::BootstrapSnapshot> {
+        let team_id = self.client.get_team_id().await.ok_or_else(|| {
+            Error::new(
+                ErrorCode::InvalidState,
+                "Team ID not set - call connect() with a team_id or set it manually",
+            )
+        })?;
+
+        // The independent fetches run concurrently; each also warms the
+        // relevant TTL caches for the calls that follow
+        let (current_user, teams, channels, unreads) = tokio::join!(
+            self.get_current_user(),
+            self.get_teams(),
+            self.get_channels(),
+            self.get_team_unreads(&team_id),
+        );
+        let channels = channels?;
+
+        // Per-channel member fetches go through the bounded batch
+        // executor; get_channel_members uses the batched cached user
+        // lookup internally, so this also warms the user cache
+        let mut members = HashMap::new();
+        if include_members {
+            let channel_ids: Vec<String> = channels.iter().map(|c| c.id.clone()).collect();
+            let results = super::batch::execute_bulk(
+                channel_ids,
+                super::batch::DEFAULT_BULK_CONCURRENCY,
+                |channel_id: String| async move { self.get_channel_members(&channel_id).await },
+            )
+            .await;
+            for (channel_id, result) in results {
+                if let Ok(list) = result {
+                    members.insert(channel_id, list);
+                }
+            }
+        }
+
+        Ok(crate::types::BootstrapSnapshot {
+            current_user: current_user?,
+            teams: teams?,
+            channels,
+            unreads: unreads?,
+            members,
+        })
+    }
+
     async fn set_status(
         &self,
         status: crate::types::user::UserStatus,
@@ -331,6 +560,19 @@ impl Platform for MattermostPlatform {
         Ok(super::status_string_to_user_status(&mm_status.status))
     }
 
+    async fn get_user_status_cached(
+        &self,
+        user_id: &str,
+    ) -> Result<crate::types::user::UserStatus> {
+        Ok(self
+            .status_map
+            .read()
+            .await
+            .get(user_id)
+            .copied()
+            .unwrap_or(crate::types::user::UserStatus::Unknown))
+    }
+
     async fn send_typing_indicator(&self, channel_id: &str, parent_id: Option<&str>) -> Result<()> {
         let ws_lock = self.websocket.lock().await;
         if let Some(ws) = ws_lock.as_ref() {
@@ -355,8 +597,48 @@ impl Platform for MattermostPlatform {
         let server_url = &self.server_url;
 
         let mut ws_manager = WebSocketManager::new(server_url, token);
+
+        // Re-install any previously registered push callback on the new manager
+        if let Some(callback) = &self.event_callback {
+            ws_manager
+                .set_event_callback(Some(Arc::clone(callback)))
+                .await;
+        }
+
+        // Re-install any previously registered subscription filter
+        if let Some(filter) = &self.event_filter {
+            ws_manager.set_event_filter(Some(filter.clone())).await;
+        }
+
+        // Share the platform's counters so they survive resubscription
+        ws_manager.set_metrics(Arc::clone(&self.ws_metrics));
+
+        // Re-install any previously configured overflow policy
+        if let Some(policy) = self.overflow_policy {
+            ws_manager.set_overflow_policy(policy).await;
+        }
+
+        // Share the platform's status map so cached statuses survive
+        // resubscription
+        ws_manager.set_status_map(Arc::clone(&self.status_map));
+
+        // Install the reconnect replay hook so events missed across a
+        // reconnect are recovered over REST and fed through the normal
+        // delivery path
+        let replay_client = Arc::clone(&self.client);
+        let hook: ReplayHook = Arc::new(move |since| {
+            let client = Arc::clone(&replay_client);
+            Box::pin(async move { Self::collect_missed_events(&client, since).await })
+        });
+        ws_manager.set_replay_hook(hook);
+
         ws_manager.connect().await?;
 
+        // Hydrate the status map once; incremental status_change pushes
+        // keep it current from here on. Failure is non-fatal - the map
+        // just starts empty
+        let _ = ws_manager.get_statuses().await;
+
         let mut ws_lock = self.websocket.lock().await;
         *ws_lock = Some(ws_manager);
 
@@ -372,6 +654,107 @@ impl Platform for MattermostPlatform {
         Ok(())
     }
 
+    async fn save_cache_snapshot(&self, path: &std::path::Path) -> Result<()> {
+        self.client.save_cache_snapshot(path).await
+    }
+
+    async fn load_cache_snapshot(&self, path: &std::path::Path) -> Result<()> {
+        self.client.load_cache_snapshot(path).await
+    }
+
+    async fn get_cache_stats(&self) -> Result<String> {
+        let stats: serde_json::Map<String, serde_json::Value> = self
+            .client
+            .cache_statistics()
+            .await
+            .into_iter()
+            .map(|(name, stats)| {
+                (
+                    name.to_string(),
+                    serde_json::to_value(stats).unwrap_or(serde_json::Value::Null),
+                )
+            })
+            .collect();
+        serde_json::to_string(&serde_json::Value::Object(stats)).map_err(|e| {
+            Error::new(
+                ErrorCode::Unknown,
+                format!("Failed to serialize cache statistics: {e}"),
+            )
+        })
+    }
+
+    async fn get_metrics(&self) -> Result<String> {
+        let (depth, capacity) = match self.websocket.lock().await.as_ref() {
+            Some(ws) => ws.queue_depth(),
+            None => (0, 0),
+        };
+        let metrics = serde_json::json!({
+            "websocket": self.ws_metrics.snapshot(),
+            "queue": {
+                "depth": depth,
+                "capacity": capacity,
+            },
+        });
+        serde_json::to_string(&metrics).map_err(|e| {
+            Error::new(
+                ErrorCode::Unknown,
+                format!("Failed to serialize metrics: {e}"),
+            )
+        })
+    }
+
+    async fn reset_metrics(&self) -> Result<()> {
+        self.ws_metrics.reset();
+        Ok(())
+    }
+
+    async fn set_event_filter(
+        &mut self,
+        event_types: Option<Vec<String>>,
+        channel_ids: Option<Vec<String>>,
+    ) -> Result<()> {
+        let filter = match (&event_types, &channel_ids) {
+            (None, None) => None,
+            _ => Some(EventFilter {
+                event_types: event_types.unwrap_or_default().into_iter().collect(),
+                channel_ids: channel_ids.unwrap_or_default().into_iter().collect(),
+            }),
+        };
+        self.event_filter = filter.clone();
+
+        // Apply immediately if a WebSocket connection is already active
+        let ws_lock = self.websocket.lock().await;
+        if let Some(ws) = ws_lock.as_ref() {
+            ws.set_event_filter(filter).await;
+        }
+
+        Ok(())
+    }
+
+    async fn set_queue_overflow_policy(&mut self, policy: OverflowPolicy) -> Result<()> {
+        self.overflow_policy = Some(policy);
+
+        // Apply immediately if a WebSocket connection is already active
+        let ws_lock = self.websocket.lock().await;
+        if let Some(ws) = ws_lock.as_ref() {
+            ws.set_overflow_policy(policy).await;
+        }
+
+        Ok(())
+    }
+
+    async fn set_event_callback(&mut self, callback: Option<EventCallback>) -> Result<()> {
+        self.event_callback = callback.clone();
+
+        // Apply immediately if a WebSocket connection is already active
+        let ws_lock = self.websocket.lock().await;
+        if let Some(ws) = ws_lock.as_ref() {
+            ws.set_event_callback(callback).await;
+        }
+
+        Ok(())
+    }
+
     async fn poll_event(&mut self) -> Result<Option<PlatformEvent>> {
         let ws_lock = self.websocket.lock().await;
         if let Some(ws) = ws_lock.as_ref() {
@@ -682,10 +1065,31 @@ impl Platform for MattermostPlatform {
         Ok(file_info.id)
     }
 
+    async fn upload_file_streaming(
+        &self,
+        channel_id: &str,
+        file_path: &std::path::Path,
+        progress: Option<crate::platforms::ProgressHandler>,
+    ) -> Result<String> {
+        let file_info = self
+            .client
+            .upload_file_streaming(channel_id, file_path, None, progress)
+            .await?;
+        Ok(file_info.id)
+    }
+
     async fn download_file(&self, file_id: &str) -> Result<Vec<u8>> {
         self.client.download_file(file_id).await
     }
 
+    async fn download_file_streaming(
+        &self,
+        file_id: &str,
+        handler: crate::platforms::ChunkHandler,
+    ) -> Result<()> {
+        self.client.download_file_streaming(file_id, handler).await
+    }
+
     async fn get_file_metadata(&self, file_id: &str) -> Result<Attachment> {
         let file_info = self.client.get_file_info(file_id).await?;
         // Convert FileInfo to Attachment using context
@@ -74,6 +74,20 @@ impl MattermostClient {
         self.handle_response(response).await
     }
 
+    /// Get posts in a channel created or updated after a timestamp
+    ///
+    /// # Arguments
+    /// * `channel_id` - The ID of the channel
+    /// * `since` - Timestamp in milliseconds since the epoch
+    ///
+    /// # Returns
+    /// A Result containing a PostList or an Error
+    pub async fn get_posts_since(&self, channel_id: &str, since: i64) -> Result<PostList> {
+        let endpoint = format!("/channels/{channel_id}/posts?since={since}");
+        let response = self.get(&endpoint).await?;
+        self.handle_response(response).await
+    }
+
     /// Get the latest posts for a channel
     ///
     /// # Arguments
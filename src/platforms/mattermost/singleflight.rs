@@ -0,0 +1,180 @@
+//! Single-flight deduplication for identical concurrent requests
+//!
+//! When a burst of events triggers lookups for the same handful of keys
+//! (e.g. the same message authors), every cache miss would otherwise issue
+//! its own HTTP request before the first response lands and populates the
+//! cache. A [`SingleFlight`] group lets concurrent callers for the same key
+//! share one in-flight future: the first caller performs the fetch and all
+//! waiting callers resolve from its result.
+
+use std::collections::HashMap;
+use tokio::sync::{broadcast, Mutex};
+
+use crate::error::{Error, ErrorCode, Result};
+
+/// A group of in-flight requests keyed by string
+///
+/// # Type Parameters
+/// * `T` - The result type of the deduplicated operation (must be Clone)
+#[derive(Debug, Default)]
+pub struct SingleFlight<T: Clone> {
+    /// Senders for requests currently in flight, keyed by request key
+    in_flight: Mutex<HashMap<String, broadcast::Sender<Result<T>>>>,
+}
+
+impl<T: Clone + Send + 'static> SingleFlight<T> {
+    /// Create a new, empty single-flight group
+    pub fn new() -> Self {
+        Self {
+            in_flight: Mutex::new(HashMap::new()),
+        }
+    }
+
+    /// Run `fetch` for `key`, sharing the result with concurrent callers
+    ///
+    /// If no request for `key` is in flight, `fetch` is executed and its
+    /// result is broadcast to every caller that arrived while it ran. If a
+    /// request is already in flight, `fetch` is dropped without running and
+    /// this call resolves from the leader's result (including errors, so a
+    /// failing server is not hammered with retries from queued callers).
+    ///
+    /// # Arguments
+    /// * `key` - The deduplication key (e.g. a user or channel ID)
+    /// * `fetch` - The operation to run when this caller is the leader
+    pub async fn run<F, Fut>(&self, key: &str, fetch: F) -> Result<T>
+    where
+        F: FnOnce() -> Fut,
+        Fut: std::future::Future<Output = Result<T>>,
+    {
+        // Join an existing flight if there is one, otherwise register as leader
+        let mut rx = {
+            let mut in_flight = self.in_flight.lock().await;
+            if let Some(tx) = in_flight.get(key) {
+                Some(tx.subscribe())
+            } else {
+                let (tx, _) = broadcast::channel(1);
+                in_flight.insert(key.to_string(), tx);
+                None
+            }
+        };
+
+        if let Some(rx) = rx.as_mut() {
+            return match rx.recv().await {
+                Ok(result) => result,
+                // The leader was cancelled before broadcasting its result
+                Err(_) => Err(Error::new(
+                    ErrorCode::Unknown,
+                    "In-flight request was cancelled",
+                )),
+            };
+        }
+
+        // Leader: perform the fetch, then deregister before broadcasting so
+        // late arrivals re-check the (now populated) cache instead of joining
+        // a finished flight
+        let result = fetch().await;
+        let tx = self.in_flight.lock().await.remove(key);
+        if let Some(tx) = tx {
+            let _ = tx.send(result.clone());
+        }
+        result
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+    use std::sync::atomic::{AtomicUsize, Ordering};
+    use std::sync::Arc;
+    use std::time::Duration;
+
+    #[tokio::test]
+    async fn test_single_caller_runs_fetch() {
+        let flight: SingleFlight<String> = SingleFlight::new();
+        let result = flight
+            .run("key", || async { Ok("value".to_string()) })
+            .await;
+        assert_eq!(result.unwrap(), "value");
+    }
+
+    #[tokio::test]
+    async fn test_concurrent_callers_share_one_fetch() {
+        let flight: Arc<SingleFlight<String>> = Arc::new(SingleFlight::new());
+        let calls = Arc::new(AtomicUsize::new(0));
+
+        let mut handles = vec![];
+        for _ in 0..10 {
+            let flight = Arc::clone(&flight);
+            let calls = Arc::clone(&calls);
+            handles.push(tokio::spawn(async move {
+                flight
+                    .run("key", || async {
+                        calls.fetch_add(1, Ordering::SeqCst);
+                        // Hold the flight open long enough for all callers to join
+                        tokio::time::sleep(Duration::from_millis(50)).await;
+                        Ok("value".to_string())
+                    })
+                    .await
+            }));
+        }
+
+        for handle in handles {
+            assert_eq!(handle.await.unwrap().unwrap(), "value");
+        }
+        assert_eq!(calls.load(Ordering::SeqCst), 1);
+    }
+
+    #[tokio::test]
+    async fn test_errors_are_shared() {
+        let flight: Arc<SingleFlight<String>> = Arc::new(SingleFlight::new());
+        let calls = Arc::new(AtomicUsize::new(0));
+
+        let mut handles = vec![];
+        for _ in 0..4 {
+            let flight = Arc::clone(&flight);
+            let calls = Arc::clone(&calls);
+            handles.push(tokio::spawn(async move {
+                flight
+                    .run("key", || async {
+                        calls.fetch_add(1, Ordering::SeqCst);
+                        tokio::time::sleep(Duration::from_millis(50)).await;
+                        Err::<String, _>(Error::new(ErrorCode::NetworkError, "boom"))
+                    })
+                    .await
+            }));
+        }
+
+        for handle in handles {
+            let err = handle.await.unwrap().unwrap_err();
+            assert_eq!(err.code, ErrorCode::NetworkError);
+        }
+        assert_eq!(calls.load(Ordering::SeqCst), 1);
+    }
+
+    #[tokio::test]
+    async fn test_different_keys_run_independently() {
+        let flight: SingleFlight<String> = SingleFlight::new();
+        let a = flight.run("a", || async { Ok("1".to_string()) }).await;
+        let b = flight.run("b", || async { Ok("2".to_string()) }).await;
+        assert_eq!(a.unwrap(), "1");
+        assert_eq!(b.unwrap(), "2");
+    }
+
+    #[tokio::test]
+    async fn test_sequential_calls_fetch_again() {
+        let flight: SingleFlight<String> = SingleFlight::new();
+        let calls = AtomicUsize::new(0);
+
+        for _ in 0..2 {
+            let result = flight
+                .run("key", || async {
+                    calls.fetch_add(1, Ordering::SeqCst);
+                    Ok("value".to_string())
+                })
+                .await;
+            assert!(result.is_ok());
+        }
+        // Each call completed before the next began, so both fetched
+        assert_eq!(calls.load(Ordering::SeqCst), 2);
+    }
+}
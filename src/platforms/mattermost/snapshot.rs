@@ -0,0 +1,160 @@
+//! Disk-backed cache snapshots for warm process starts
+//!
+//! The TTL caches are purely in-memory, so every restart cold-starts with a
+//! burst of `get_user`/`get_channel`/`get_team` API calls. Saving a snapshot
+//! on shutdown and loading it on startup lets a new process begin with a warm
+//! cache: loaded entries keep their remaining TTL (capped at the configured
+//! TTL) and are revalidated against the server lazily as they expire.
+
+use std::path::Path;
+
+use serde::{Deserialize, Serialize};
+
+use crate::error::{Error, ErrorCode, Result};
+
+use super::client::MattermostClient;
+use super::types::{MattermostChannel, MattermostTeam, MattermostUser};
+
+/// On-disk format version, bumped on incompatible layout changes
+const SNAPSHOT_VERSION: u32 = 1;
+
+/// Serialized form of the user/channel/team caches
+///
+/// Entries carry their remaining TTL in milliseconds so a snapshot taken just
+/// before shutdown does not resurrect long-expired data.
+#[derive(Serialize, Deserialize)]
+struct CacheSnapshot {
+    version: u32,
+    users: Vec<(String, MattermostUser, u64)>,
+    channels: Vec<(String, MattermostChannel, u64)>,
+    teams: Vec<(String, MattermostTeam, u64)>,
+}
+
+impl MattermostClient {
+    /// Save the current cache contents to a snapshot file
+    ///
+    /// Expired entries are skipped. The file is written atomically via a
+    /// temporary file and rename so a crash mid-write cannot corrupt an
+    /// existing snapshot.
+    ///
+    /// # Arguments
+    /// * `path` - Where to write the snapshot file
+    pub async fn save_cache_snapshot(&self, path: &Path) -> Result<()> {
+        let snapshot = CacheSnapshot {
+            version: SNAPSHOT_VERSION,
+            users: self.user_cache.export_entries().await,
+            channels: self.channel_cache.export_entries().await,
+            teams: self.team_cache.export_entries().await,
+        };
+
+        let data = serde_json::to_vec(&snapshot).map_err(|e| {
+            Error::new(
+                ErrorCode::Unknown,
+                format!("Failed to serialize cache snapshot: {e}"),
+            )
+        })?;
+
+        let tmp_path = path.with_extension("tmp");
+        tokio::fs::write(&tmp_path, &data).await.map_err(|e| {
+            Error::new(
+                ErrorCode::InvalidArgument,
+                format!("Failed to write cache snapshot: {e}"),
+            )
+        })?;
+        tokio::fs::rename(&tmp_path, path).await.map_err(|e| {
+            Error::new(
+                ErrorCode::InvalidArgument,
+                format!("Failed to finalize cache snapshot: {e}"),
+            )
+        })?;
+
+        Ok(())
+    }
+
+    /// Load cache contents from a snapshot file
+    ///
+    /// Entries are imported with their remaining TTL, capped at the
+    /// configured TTL for each cache, and revalidated lazily against the
+    /// server as they expire. A snapshot with an unknown version is rejected.
+    ///
+    /// # Arguments
+    /// * `path` - The snapshot file to load
+    pub async fn load_cache_snapshot(&self, path: &Path) -> Result<()> {
+        let data = tokio::fs::read(path).await.map_err(|e| {
+            Error::new(
+                ErrorCode::NotFound,
+                format!("Failed to read cache snapshot: {e}"),
+            )
+        })?;
+
+        let snapshot: CacheSnapshot = serde_json::from_slice(&data).map_err(|e| {
+            Error::new(
+                ErrorCode::InvalidArgument,
+                format!("Failed to parse cache snapshot: {e}"),
+            )
+        })?;
+
+        if snapshot.version != SNAPSHOT_VERSION {
+            return Err(Error::new(
+                ErrorCode::InvalidArgument,
+                format!(
+                    "Unsupported cache snapshot version {} (expected {})",
+                    snapshot.version, SNAPSHOT_VERSION
+                ),
+            ));
+        }
+
+        self.user_cache.import_entries(snapshot.users).await;
+        self.channel_cache.import_entries(snapshot.channels).await;
+        self.team_cache.import_entries(snapshot.teams).await;
+
+        Ok(())
+    }
+}
+
+#[cfg(test)]
+mod tests {
+    use super::*;
+
+    fn test_user(id: &str) -> MattermostUser {
+        serde_json::from_value(serde_json::json!({
+            "id": id,
+            "username": format!("user-{id}"),
+            "create_at": 0,
+            "update_at": 0,
+            "delete_at": 0,
+        }))
+        .unwrap()
+    }
+
+    #[tokio::test]
+    async fn test_snapshot_roundtrip() {
+        let dir = std::env::temp_dir().join("communicator-snapshot-test");
+        tokio::fs::create_dir_all(&dir).await.unwrap();
+        let path = dir.join("cache.snapshot");
+
+        let client = MattermostClient::new("https://mattermost.example.com").unwrap();
+        client
+            .user_cache
+            .set("u1".to_string(), test_user("u1"))
+            .await;
+
+        client.save_cache_snapshot(&path).await.unwrap();
+
+        let restored = MattermostClient::new("https://mattermost.example.com").unwrap();
+        restored.load_cache_snapshot(&path).await.unwrap();
+        let user = restored.user_cache.get("u1").await;
+        assert_eq!(user.map(|u| u.id), Some("u1".to_string()));
+
+        let _ = tokio::fs::remove_file(&path).await;
+    }
+
+    #[tokio::test]
+    async fn test_snapshot_missing_file() {
+        let client = MattermostClient::new("https://mattermost.example.com").unwrap();
+        let result = client
+            .load_cache_snapshot(Path::new("/nonexistent/cache.snapshot"))
+            .await;
+        assert!(result.is_err());
+    }
+}
@@ -1,6 +1,7 @@
 use crate::error::Result;
 
 use super::client::MattermostClient;
+use super::scheduler::RequestPriority;
 use super::types::MattermostUser;
 
 impl MattermostClient {
@@ -54,13 +55,18 @@ impl MattermostClient {
 
     /// Get multiple users by their IDs
     ///
+    /// Runs in the background scheduler lane: this is the bulk enrichment
+    /// path, so it yields to interactive requests under rate limiting.
+    ///
     /// # Arguments
     /// * `user_ids` - A list of user IDs to retrieve
     ///
     /// # Returns
     /// A Result containing a list of users or an Error
     pub async fn get_users_by_ids(&self, user_ids: &[String]) -> Result<Vec<MattermostUser>> {
-        let response = self.post("/users/ids", &user_ids).await?;
+        let response = self
+            .post_with_priority("/users/ids", &user_ids, RequestPriority::Background)
+            .await?;
         self.handle_response(response).await
     }
 }
@@ -1,11 +1,15 @@
 use futures::{stream::SplitSink, SinkExt, StreamExt};
+use std::collections::{HashMap, HashSet};
+use std::sync::atomic::{AtomicI64, AtomicU32, AtomicU64, AtomicU8, Ordering};
 use std::sync::Arc;
+use std::sync::Mutex as StdMutex;
 use tokio::net::TcpStream;
-use tokio::sync::{mpsc, Mutex};
+use tokio::sync::{mpsc, Mutex, RwLock};
 use tokio_tungstenite::{connect_async, tungstenite::Message, MaybeTlsStream, WebSocketStream};
 
 use crate::error::{Error, ErrorCode, Result};
-use crate::platforms::platform_trait::PlatformEvent;
+use crate::platforms::platform_trait::{EventCallback, OverflowPolicy, PlatformEvent};
+use crate::types::user::UserStatus;
 
 use super::types::{
     MattermostChannel, MattermostPost, WebSocketAuthChallenge, WebSocketAuthData,
@@ -15,19 +19,54 @@ use super::types::{
 /// Type alias for the WebSocket write half
 type WsWriter = SplitSink<WebSocketStream<MaybeTlsStream<TcpStream>>, Message>;
 
+/// Capacity of the channel feeding the dedicated writer task
+///
+/// Sized for bursts of small control frames (typing indicators, status
+/// requests); senders only block when the writer falls this far behind.
+const OUTBOUND_QUEUE_SIZE: usize = 64;
+
+/// Hook invoked after a successful reconnect to recover missed events
+///
+/// Receives the time (epoch ms) the connection was lost and returns the
+/// events missed while down, in order. Installed by the platform, which
+/// knows how to fetch the window over REST; the manager only replays what
+/// it is given through the normal delivery path.
+pub type ReplayHook = Arc<
+    dyn Fn(i64) -> std::pin::Pin<Box<dyn std::future::Future<Output = Vec<PlatformEvent>> + Send>>
+        + Send
+        + Sync,
+>;
+
 /// WebSocket connection state
+///
+/// Stored as an `AtomicU8` discriminant so state reads and transitions on
+/// the connection task never take a lock.
 #[derive(Debug, Clone, Copy, PartialEq, Eq)]
+#[repr(u8)]
 pub enum ConnectionState {
     /// Not connected
-    Disconnected,
+    Disconnected = 0,
     /// Attempting to connect
-    Connecting,
+    Connecting = 1,
     /// Successfully connected and authenticated
-    Connected,
+    Connected = 2,
     /// Attempting to reconnect after disconnection
-    Reconnecting,
+    Reconnecting = 3,
     /// Shutting down gracefully
-    ShuttingDown,
+    ShuttingDown = 4,
+}
+
+impl ConnectionState {
+    /// Reconstruct a state from its atomic discriminant
+    fn from_u8(value: u8) -> Self {
+        match value {
+            1 => ConnectionState::Connecting,
+            2 => ConnectionState::Connected,
+            3 => ConnectionState::Reconnecting,
+            4 => ConnectionState::ShuttingDown,
+            _ => ConnectionState::Disconnected,
+        }
+    }
 }
 
 /// Configuration for WebSocket connection
@@ -65,6 +104,192 @@ impl Default for WebSocketConfig {
     }
 }
 
+/// Subscription filter for incoming WebSocket events
+///
+/// Frames that do not match are dropped before full deserialization and
+/// never occupy the event queue. An empty set means "no constraint" on
+/// that dimension. Event types are platform-native names (e.g. "posted",
+/// "typing" for Mattermost).
+#[derive(Debug, Clone, Default)]
+pub struct EventFilter {
+    /// Event types to accept (empty = accept all types)
+    pub event_types: HashSet<String>,
+    /// Channel IDs to accept (empty = accept all channels)
+    pub channel_ids: HashSet<String>,
+}
+
+impl EventFilter {
+    /// Check whether an event type passes the filter
+    fn accepts_type(&self, event_type: &str) -> bool {
+        self.event_types.is_empty() || self.event_types.contains(event_type)
+    }
+
+    /// Check whether a channel passes the filter
+    ///
+    /// Events without a channel (empty broadcast channel_id, e.g. server
+    /// config changes or WebSocket API responses) always pass so the
+    /// channel filter cannot break request/response correlation.
+    fn accepts_channel(&self, channel_id: &str) -> bool {
+        self.channel_ids.is_empty()
+            || channel_id.is_empty()
+            || self.channel_ids.contains(channel_id)
+    }
+}
+
+/// Counters for WebSocket connection health and event queue pressure
+///
+/// Shared between the platform and the connection task so the numbers
+/// survive reconnects. All counters are relaxed atomics: they are
+/// monotonically increasing diagnostics, not synchronization points.
+#[derive(Debug, Default)]
+pub struct WsMetrics {
+    /// Reconnection attempts started (successful or not)
+    reconnect_attempts: AtomicU64,
+    /// Reconnections that completed and re-authenticated
+    reconnects: AtomicU64,
+    /// Connection losses outside of graceful shutdown
+    disconnects: AtomicU64,
+    /// Text frames received from the server
+    frames_received: AtomicU64,
+    /// Events dropped because the event queue was full
+    events_dropped: AtomicU64,
+    /// Highest event queue depth observed since the last reset
+    queue_high_water: AtomicU64,
+    /// Drop counts broken down by event type
+    ///
+    /// A plain mutex is fine here: drops are the exceptional path, and the
+    /// lock is only contended against metrics snapshots.
+    dropped_by_type: StdMutex<HashMap<&'static str, u64>>,
+}
+
+impl WsMetrics {
+    fn record_reconnect_attempt(&self) {
+        self.reconnect_attempts.fetch_add(1, Ordering::Relaxed);
+    }
+
+    fn record_reconnect(&self) {
+        self.reconnects.fetch_add(1, Ordering::Relaxed);
+    }
+
+    fn record_disconnect(&self) {
+        self.disconnects.fetch_add(1, Ordering::Relaxed);
+    }
+
+    fn record_frame(&self) {
+        self.frames_received.fetch_add(1, Ordering::Relaxed);
+    }
+
+    fn record_dropped_event(&self, event_type: &'static str) {
+        self.events_dropped.fetch_add(1, Ordering::Relaxed);
+        let mut by_type = self
+            .dropped_by_type
+            .lock()
+            .unwrap_or_else(|e| e.into_inner());
+        *by_type.entry(event_type).or_insert(0) += 1;
+    }
+
+    fn record_queue_depth(&self, depth: u64) {
+        self.queue_high_water.fetch_max(depth, Ordering::Relaxed);
+    }
+
+    /// Snapshot all counters as a JSON object
+    pub fn snapshot(&self) -> serde_json::Value {
+        let by_type: serde_json::Map<String, serde_json::Value> = self
+            .dropped_by_type
+            .lock()
+            .unwrap_or_else(|e| e.into_inner())
+            .iter()
+            .map(|(event_type, count)| ((*event_type).to_string(), serde_json::Value::from(*count)))
+            .collect();
+        serde_json::json!({
+            "reconnect_attempts": self.reconnect_attempts.load(Ordering::Relaxed),
+            "reconnects": self.reconnects.load(Ordering::Relaxed),
+            "disconnects": self.disconnects.load(Ordering::Relaxed),
+            "frames_received": self.frames_received.load(Ordering::Relaxed),
+            "events_dropped": self.events_dropped.load(Ordering::Relaxed),
+            "events_dropped_by_type": by_type,
+            "queue_high_water": self.queue_high_water.load(Ordering::Relaxed),
+        })
+    }
+
+    /// Reset all counters to zero
+    pub fn reset(&self) {
+        self.reconnect_attempts.store(0, Ordering::Relaxed);
+        self.reconnects.store(0, Ordering::Relaxed);
+        self.disconnects.store(0, Ordering::Relaxed);
+        self.frames_received.store(0, Ordering::Relaxed);
+        self.events_dropped.store(0, Ordering::Relaxed);
+        self.queue_high_water.store(0, Ordering::Relaxed);
+        self.dropped_by_type
+            .lock()
+            .unwrap_or_else(|e| e.into_inner())
+            .clear();
+    }
+}
+
+/// Sender-side view of the event queue with its overflow policy
+///
+/// Handed to the connection task so event delivery can apply the policy
+/// without reaching back into the manager. Holds a receiver handle as well
+/// because the drop-oldest policy evicts from the head of the queue.
+pub(crate) struct EventQueue {
+    tx: mpsc::Sender<PlatformEvent>,
+    rx: Arc<Mutex<mpsc::Receiver<PlatformEvent>>>,
+    policy: Arc<RwLock<OverflowPolicy>>,
+}
+
+impl EventQueue {
+    /// Deliver an event to the queue, applying the overflow policy when
+    /// it is full
+    async fn deliver(&self, event: PlatformEvent, metrics: &WsMetrics) {
+        let policy = *self.policy.read().await;
+        match policy {
+            OverflowPolicy::DropNewest => match self.tx.try_send(event) {
+                Ok(()) => self.record_depth(metrics),
+                Err(mpsc::error::TrySendError::Full(event)) => {
+                    metrics.record_dropped_event(event.type_name());
+                }
+                Err(mpsc::error::TrySendError::Closed(_)) => {}
+            },
+            OverflowPolicy::DropOldest => {
+                let mut event = event;
+                loop {
+                    match self.tx.try_send(event) {
+                        Ok(()) => {
+                            self.record_depth(metrics);
+                            break;
+                        }
+                        Err(mpsc::error::TrySendError::Full(returned)) => {
+                            event = returned;
+                            // Evict the head of the queue to make room; if
+                            // the consumer drained it meanwhile, just retry
+                            if let Ok(oldest) = self.rx.lock().await.try_recv() {
+                                metrics.record_dropped_event(oldest.type_name());
+                            }
+                        }
+                        Err(mpsc::error::TrySendError::Closed(_)) => break,
+                    }
+                }
+            }
+            OverflowPolicy::BlockWithTimeout(timeout) => {
+                match self.tx.send_timeout(event, timeout).await {
+                    Ok(()) => self.record_depth(metrics),
+                    Err(mpsc::error::SendTimeoutError::Timeout(event)) => {
+                        metrics.record_dropped_event(event.type_name());
+                    }
+                    Err(mpsc::error::SendTimeoutError::Closed(_)) => {}
+                }
+            }
+        }
+    }
+
+    /// Track the queue depth high-water mark after a successful send
+    fn record_depth(&self, metrics: &WsMetrics) {
+        let depth = self.tx.max_capacity() - self.tx.capacity();
+        metrics.record_queue_depth(depth as u64);
+    }
+}
+
 /// WebSocket connection manager for Mattermost
 pub struct WebSocketManager {
     /// URL for the WebSocket connection
@@ -77,18 +302,35 @@ pub struct WebSocketManager {
     event_tx: mpsc::Sender<PlatformEvent>,
     /// Event receiver for polling events
     event_rx: Arc<Mutex<mpsc::Receiver<PlatformEvent>>>,
-    /// WebSocket write half for sending messages
-    ws_writer: Arc<Mutex<Option<WsWriter>>>,
+    /// Optional callback for push-mode event delivery (bypasses the queue)
+    event_callback: Arc<RwLock<Option<EventCallback>>>,
+    /// Optional subscription filter applied before event deserialization
+    event_filter: Arc<RwLock<Option<EventFilter>>>,
+    /// Sender feeding the dedicated writer task (None while disconnected)
+    ///
+    /// The RwLock is only written on connect/disconnect transitions; the
+    /// send path takes an uncontended read lock and enqueues.
+    outbound_tx: Arc<RwLock<Option<mpsc::Sender<Message>>>>,
     /// Shutdown signal sender
     shutdown_tx: Option<mpsc::Sender<()>>,
     /// Sequence number for WebSocket messages
-    seq_number: Arc<Mutex<i64>>,
+    seq_number: Arc<AtomicI64>,
     /// Last received sequence number for gap detection
-    last_received_seq: Arc<Mutex<i64>>,
-    /// Current connection state
-    connection_state: Arc<Mutex<ConnectionState>>,
+    last_received_seq: Arc<AtomicI64>,
+    /// Current connection state (a `ConnectionState` discriminant)
+    connection_state: Arc<AtomicU8>,
     /// Current number of reconnection attempts
-    reconnect_attempts: Arc<Mutex<u32>>,
+    reconnect_attempts: Arc<AtomicU32>,
+    /// Connection and queue counters, shared with the connection task
+    metrics: Arc<WsMetrics>,
+    /// Policy applied when the event queue is full
+    overflow_policy: Arc<RwLock<OverflowPolicy>>,
+    /// Live user status map, maintained from status pushes
+    status_map: Arc<RwLock<HashMap<String, UserStatus>>>,
+    /// Hook used to replay events missed across a reconnect
+    replay_hook: Option<ReplayHook>,
+    /// When the connection was lost (epoch ms, 0 = not disconnected)
+    disconnected_at: Arc<AtomicI64>,
 }
 
 impl WebSocketManager {
@@ -123,12 +365,70 @@ impl WebSocketManager {
             config,
             event_tx,
             event_rx: Arc::new(Mutex::new(event_rx)),
-            ws_writer: Arc::new(Mutex::new(None)),
+            event_callback: Arc::new(RwLock::new(None)),
+            event_filter: Arc::new(RwLock::new(None)),
+            outbound_tx: Arc::new(RwLock::new(None)),
             shutdown_tx: None,
-            seq_number: Arc::new(Mutex::new(1)),
-            last_received_seq: Arc::new(Mutex::new(0)),
-            connection_state: Arc::new(Mutex::new(ConnectionState::Disconnected)),
-            reconnect_attempts: Arc::new(Mutex::new(0)),
+            seq_number: Arc::new(AtomicI64::new(1)),
+            last_received_seq: Arc::new(AtomicI64::new(0)),
+            connection_state: Arc::new(AtomicU8::new(ConnectionState::Disconnected as u8)),
+            reconnect_attempts: Arc::new(AtomicU32::new(0)),
+            metrics: Arc::new(WsMetrics::default()),
+            overflow_policy: Arc::new(RwLock::new(OverflowPolicy::default())),
+            status_map: Arc::new(RwLock::new(HashMap::new())),
+            replay_hook: None,
+            disconnected_at: Arc::new(AtomicI64::new(0)),
+        }
+    }
+
+    /// Replace the metrics instance with a shared one
+    ///
+    /// The platform installs its own instance before connecting so counters
+    /// accumulate across unsubscribe/resubscribe cycles, which tear down and
+    /// recreate the manager.
+    pub fn set_metrics(&mut self, metrics: Arc<WsMetrics>) {
+        self.metrics = metrics;
+    }
+
+    /// Replace the status map with a shared one
+    ///
+    /// Installed by the platform before connecting, like the metrics
+    /// instance, so cached statuses survive resubscription.
+    pub fn set_status_map(&mut self, status_map: Arc<RwLock<HashMap<String, UserStatus>>>) {
+        self.status_map = status_map;
+    }
+
+    /// Install the reconnect replay hook
+    ///
+    /// Installed by the platform before connecting. After a successful
+    /// reconnect the connection task calls the hook with the disconnect
+    /// timestamp and feeds the returned events through the normal delivery
+    /// path, so consumers see a gapless stream instead of triggering a
+    /// full re-sync on every reconnect.
+    pub fn set_replay_hook(&mut self, hook: ReplayHook) {
+        self.replay_hook = Some(hook);
+    }
+
+    /// Set the policy applied when the event queue is full
+    ///
+    /// Takes effect for the next delivered event; events already queued are
+    /// unaffected.
+    pub async fn set_overflow_policy(&self, policy: OverflowPolicy) {
+        *self.overflow_policy.write().await = policy;
+    }
+
+    /// Current event queue depth and total capacity
+    pub fn queue_depth(&self) -> (usize, usize) {
+        let capacity = self.event_tx.max_capacity();
+        (capacity - self.event_tx.capacity(), capacity)
+    }
+
+    /// Build the queue view handed to the connection task
+    fn event_queue(&self) -> EventQueue {
+        EventQueue {
+            tx: self.event_tx.clone(),
+            rx: Arc::clone(&self.event_rx),
+            policy: Arc::clone(&self.overflow_policy),
         }
     }
 
@@ -144,7 +444,7 @@ impl WebSocketManager {
     ) -> Result<()> {
         let action = serde_json::json!({
             "action": "user_typing",
-            "seq": self.next_seq().await,
+            "seq": self.next_seq(),
             "data": {
                 "channel_id": channel_id,
                 "parent_id": parent_id.unwrap_or(""),
@@ -164,7 +464,7 @@ impl WebSocketManager {
     /// The sequence number of the request. You can match this with the `seq_reply`
     /// field in the Response event to identify the response.
     pub async fn get_statuses(&self) -> Result<i64> {
-        let seq = self.next_seq().await;
+        let seq = self.next_seq();
         let action = serde_json::json!({
             "action": "get_statuses",
             "seq": seq,
@@ -184,7 +484,7 @@ impl WebSocketManager {
     /// The sequence number of the request. You can match this with the `seq_reply`
     /// field in the Response event to identify the response.
     pub async fn get_statuses_by_ids(&self, user_ids: Vec<String>) -> Result<i64> {
-        let seq = self.next_seq().await;
+        let seq = self.next_seq();
         let action = serde_json::json!({
             "action": "get_statuses_by_ids",
             "seq": seq,
@@ -198,14 +498,36 @@ impl WebSocketManager {
         Ok(seq)
     }
 
+    /// Set or clear the callback for push-mode event delivery
+    ///
+    /// When a callback is set, incoming events are delivered directly to it
+    /// from the message-handling task instead of being queued for `poll_event`.
+    ///
+    /// # Arguments
+    /// * `callback` - The callback to install, or None to return to poll-based delivery
+    pub async fn set_event_callback(&self, callback: Option<EventCallback>) {
+        *self.event_callback.write().await = callback;
+    }
+
+    /// Set or clear the subscription filter for incoming events
+    ///
+    /// Filtered frames are dropped with a cheap type-field check before
+    /// full deserialization and never reach the event queue or callback.
+    ///
+    /// # Arguments
+    /// * `filter` - The filter to install, or None to accept all events
+    pub async fn set_event_filter(&self, filter: Option<EventFilter>) {
+        *self.event_filter.write().await = filter;
+    }
+
     /// Get the current connection state
-    pub async fn get_connection_state(&self) -> ConnectionState {
-        *self.connection_state.lock().await
+    pub fn get_connection_state(&self) -> ConnectionState {
+        ConnectionState::from_u8(self.connection_state.load(Ordering::Relaxed))
     }
 
     /// Set the connection state
-    async fn set_connection_state(&self, state: ConnectionState) {
-        *self.connection_state.lock().await = state;
+    fn set_connection_state(&self, state: ConnectionState) {
+        self.connection_state.store(state as u8, Ordering::Relaxed);
     }
 
     /// Calculate exponential backoff delay in milliseconds (static helper)
@@ -228,42 +550,78 @@ impl WebSocketManager {
         delay.min(max as f64) as u64
     }
 
+    /// Current time in milliseconds since the epoch
+    fn now_ms() -> i64 {
+        std::time::SystemTime::now()
+            .duration_since(std::time::UNIX_EPOCH)
+            .map(|d| d.as_millis() as i64)
+            .unwrap_or(0)
+    }
+
     /// Reset reconnection attempt counter
-    async fn reset_reconnect_attempts(&self) {
-        *self.reconnect_attempts.lock().await = 0;
+    fn reset_reconnect_attempts(&self) {
+        self.reconnect_attempts.store(0, Ordering::Relaxed);
     }
 
     /// Send a WebSocket message
     ///
+    /// The send path never touches the sink: it enqueues onto the bounded
+    /// outbound channel and the dedicated writer task does the I/O, so
+    /// concurrent senders do not serialize on a sink lock.
+    ///
     /// # Arguments
     /// * `message` - The message to send
     ///
     /// # Returns
     /// Result indicating success or failure
     async fn send_ws_message(&self, message: Message) -> Result<()> {
-        let mut writer = self.ws_writer.lock().await;
-        if let Some(ws) = writer.as_mut() {
-            ws.send(message).await.map_err(|e| {
-                Error::new(
-                    ErrorCode::NetworkError,
-                    format!("Failed to send WebSocket message: {e}"),
-                )
-            })?;
-            Ok(())
-        } else {
-            Err(Error::new(
-                ErrorCode::InvalidState,
-                "WebSocket not connected",
-            ))
+        Self::enqueue_outbound(&self.outbound_tx, message)
+            .await
+            .map_err(|_| Error::new(ErrorCode::InvalidState, "WebSocket not connected"))
+    }
+
+    /// Enqueue a message for the dedicated writer task
+    ///
+    /// Returns Err when no writer task is running (disconnected) or the
+    /// task has stopped, so callers can treat the connection as lost.
+    async fn enqueue_outbound(
+        outbound_tx: &RwLock<Option<mpsc::Sender<Message>>>,
+        message: Message,
+    ) -> std::result::Result<(), ()> {
+        let tx = outbound_tx.read().await.clone();
+        match tx {
+            Some(tx) => tx.send(message).await.map_err(|_| ()),
+            None => Err(()),
         }
     }
 
+    /// The dedicated writer task: owns the sink exclusively
+    ///
+    /// Coalesces whatever is already queued into a single flush, so bursts
+    /// of small frames (typing indicators, status requests) do not pay one
+    /// syscall each. Exits when the outbound channel closes (disconnect)
+    /// or the sink errors; the read side detects a dead connection on its
+    /// own.
+    async fn run_writer(mut sink: WsWriter, mut rx: mpsc::Receiver<Message>) {
+        while let Some(message) = rx.recv().await {
+            if sink.feed(message).await.is_err() {
+                return;
+            }
+            while let Ok(next) = rx.try_recv() {
+                if sink.feed(next).await.is_err() {
+                    return;
+                }
+            }
+            if sink.flush().await.is_err() {
+                return;
+            }
+        }
+        let _ = sink.close().await;
+    }
+
     /// Get next sequence number for WebSocket messages
-    async fn next_seq(&self) -> i64 {
-        let mut seq_num = self.seq_number.lock().await;
-        let current = *seq_num;
-        *seq_num += 1;
-        current
+    fn next_seq(&self) -> i64 {
+        self.seq_number.fetch_add(1, Ordering::Relaxed)
     }
 
     /// Connect to the Mattermost WebSocket and start receiving events
@@ -271,14 +629,11 @@ impl WebSocketManager {
     /// # Returns
     /// A Result indicating success or failure
     pub async fn connect(&mut self) -> Result<()> {
-        self.set_connection_state(ConnectionState::Connecting).await;
+        self.set_connection_state(ConnectionState::Connecting);
 
         let (ws_stream, _) = connect_async(&self.ws_url).await.map_err(|e| {
             // Set state back to disconnected on failure
-            let state = self.connection_state.clone();
-            tokio::spawn(async move {
-                *state.lock().await = ConnectionState::Disconnected;
-            });
+            self.set_connection_state(ConnectionState::Disconnected);
             Error::new(
                 ErrorCode::NetworkError,
                 format!("WebSocket connection failed: {e}"),
@@ -288,12 +643,7 @@ impl WebSocketManager {
         let (mut write, read) = ws_stream.split();
 
         // Send authentication challenge
-        let seq = {
-            let mut seq_num = self.seq_number.lock().await;
-            let current = *seq_num;
-            *seq_num += 1;
-            current
-        };
+        let seq = self.next_seq();
 
         let auth_challenge = WebSocketAuthChallenge {
             seq,
@@ -311,8 +661,11 @@ impl WebSocketManager {
             Error::new(ErrorCode::NetworkError, format!("Failed to send auth: {e}"))
         })?;
 
-        // Store the write half for bidirectional communication
-        *self.ws_writer.lock().await = Some(write);
+        // Hand the write half to a dedicated writer task; everything else
+        // sends by enqueueing onto the outbound channel
+        let (outbound, outbound_rx) = mpsc::channel::<Message>(OUTBOUND_QUEUE_SIZE);
+        tokio::spawn(Self::run_writer(write, outbound_rx));
+        *self.outbound_tx.write().await = Some(outbound);
 
         // Note: The authentication response will arrive as a separate WebSocket message
         // with the structure: {"status": "OK", "seq_reply": <seq>}
@@ -322,21 +675,27 @@ impl WebSocketManager {
         // receiving events successfully.
 
         // Mark as connected after successful authentication challenge sent
-        self.set_connection_state(ConnectionState::Connected).await;
+        self.set_connection_state(ConnectionState::Connected);
 
         // Reset reconnection counter on successful connection
-        self.reset_reconnect_attempts().await;
+        self.reset_reconnect_attempts();
 
         // Create shutdown channel
         let (shutdown_tx, shutdown_rx) = mpsc::channel::<()>(1);
         self.shutdown_tx = Some(shutdown_tx);
 
         // Clone references for the spawned task
-        let event_tx = self.event_tx.clone();
+        let queue = self.event_queue();
+        let status_map = Arc::clone(&self.status_map);
+        let event_callback = Arc::clone(&self.event_callback);
+        let event_filter = Arc::clone(&self.event_filter);
         let connection_state = Arc::clone(&self.connection_state);
-        let ws_writer = Arc::clone(&self.ws_writer);
+        let outbound_tx = Arc::clone(&self.outbound_tx);
         let last_received_seq = Arc::clone(&self.last_received_seq);
         let reconnect_attempts = Arc::clone(&self.reconnect_attempts);
+        let metrics = Arc::clone(&self.metrics);
+        let replay_hook = self.replay_hook.clone();
+        let disconnected_at = Arc::clone(&self.disconnected_at);
         let ping_interval = std::time::Duration::from_secs(self.config.ping_interval_secs);
 
         // Clone config and connection info for reconnection
@@ -358,34 +717,32 @@ impl WebSocketManager {
                     msg = read.next() => {
                         match msg {
                             Some(Ok(Message::Text(text))) => {
-                                let _ = Self::handle_message(text, &event_tx, &last_received_seq).await;
+                                let _ = Self::handle_message(text, &queue, &event_callback, &event_filter, &last_received_seq, &metrics, &status_map).await;
                             }
                             Some(Ok(Message::Ping(data))) => {
-                                // Respond to ping with pong
-                                if let Some(writer) = ws_writer.lock().await.as_mut() {
-                                    if writer.send(Message::Pong(data)).await.is_err() {
-                                        *connection_state.lock().await = ConnectionState::Disconnected;
-                                        *ws_writer.lock().await = None;
-                                        break;
-                                    }
+                                // Respond to ping with pong via the writer task
+                                if Self::enqueue_outbound(&outbound_tx, Message::Pong(data)).await.is_err() {
+                                    connection_state.store(ConnectionState::Disconnected as u8, Ordering::Relaxed);
+                                    *outbound_tx.write().await = None;
+                                    break;
                                 }
                             }
                             Some(Ok(Message::Pong(_))) => {
                                 // Pong received - connection is alive
                             }
                             Some(Ok(Message::Close(_))) => {
-                                *connection_state.lock().await = ConnectionState::Disconnected;
-                                *ws_writer.lock().await = None;
+                                connection_state.store(ConnectionState::Disconnected as u8, Ordering::Relaxed);
+                                *outbound_tx.write().await = None;
                                 break;
                             }
                             Some(Err(_)) => {
-                                *connection_state.lock().await = ConnectionState::Disconnected;
-                                *ws_writer.lock().await = None;
+                                connection_state.store(ConnectionState::Disconnected as u8, Ordering::Relaxed);
+                                *outbound_tx.write().await = None;
                                 break;
                             }
                             None => {
-                                *connection_state.lock().await = ConnectionState::Disconnected;
-                                *ws_writer.lock().await = None;
+                                connection_state.store(ConnectionState::Disconnected as u8, Ordering::Relaxed);
+                                *outbound_tx.write().await = None;
                                 break;
                             }
                             _ => {}
@@ -393,52 +750,50 @@ impl WebSocketManager {
                     }
                     // Send periodic ping to keep connection alive
                     _ = ping_timer.tick() => {
-                        if let Some(writer) = ws_writer.lock().await.as_mut() {
-                            if writer.send(Message::Ping(vec![])).await.is_err() {
-                                *connection_state.lock().await = ConnectionState::Disconnected;
-                                *ws_writer.lock().await = None;
-                                break;
-                            }
+                        if Self::enqueue_outbound(&outbound_tx, Message::Ping(vec![])).await.is_err() {
+                            connection_state.store(ConnectionState::Disconnected as u8, Ordering::Relaxed);
+                            *outbound_tx.write().await = None;
+                            break;
                         }
                     }
                     // Handle shutdown signal
                     _ = current_shutdown_rx.recv() => {
-                        *connection_state.lock().await = ConnectionState::ShuttingDown;
-                        *ws_writer.lock().await = None;
+                        connection_state.store(ConnectionState::ShuttingDown as u8, Ordering::Relaxed);
+                        *outbound_tx.write().await = None;
                         break;
                     }
                 }
             }
 
             // After disconnect, check if we should attempt reconnection
-            let current_state = *connection_state.lock().await;
+            let current_state = ConnectionState::from_u8(connection_state.load(Ordering::Relaxed));
+            if current_state != ConnectionState::ShuttingDown {
+                metrics.record_disconnect();
+                disconnected_at.store(Self::now_ms(), Ordering::Relaxed);
+            }
 
             // Only attempt reconnection if not shutting down and auto-reconnect is enabled
             if current_state != ConnectionState::ShuttingDown && config.enable_auto_reconnect {
                 // Reconnection loop with exponential backoff
                 loop {
                     // Get current attempt count
-                    let attempt_num = {
-                        let attempts = reconnect_attempts.lock().await;
-                        *attempts
-                    };
+                    let attempt_num = reconnect_attempts.load(Ordering::Relaxed);
 
                     // Check if we've exceeded max attempts
                     if let Some(max_attempts) = config.max_reconnect_attempts {
                         if attempt_num >= max_attempts {
-                            *connection_state.lock().await = ConnectionState::Disconnected;
+                            connection_state
+                                .store(ConnectionState::Disconnected as u8, Ordering::Relaxed);
                             break;
                         }
                     }
 
                     // Increment reconnect attempts
-                    {
-                        let mut attempts = reconnect_attempts.lock().await;
-                        *attempts += 1;
-                    }
+                    reconnect_attempts.fetch_add(1, Ordering::Relaxed);
+                    metrics.record_reconnect_attempt();
 
                     // Set state to Reconnecting
-                    *connection_state.lock().await = ConnectionState::Reconnecting;
+                    connection_state.store(ConnectionState::Reconnecting as u8, Ordering::Relaxed);
 
                     // Calculate backoff delay using the WebSocketManager method
                     // We need to create a temporary manager instance to access the method
@@ -454,12 +809,7 @@ impl WebSocketManager {
                             let (mut write, new_read) = ws_stream.split();
 
                             // Send authentication challenge
-                            let seq = {
-                                let mut seq_num = seq_number.lock().await;
-                                let current = *seq_num;
-                                *seq_num += 1;
-                                current
-                            };
+                            let seq = seq_number.fetch_add(1, Ordering::Relaxed);
 
                             let auth_challenge = WebSocketAuthChallenge {
                                 seq,
@@ -472,68 +822,89 @@ impl WebSocketManager {
                             if let Ok(auth_msg) = serde_json::to_string(&auth_challenge) {
                                 if write.send(Message::Text(auth_msg)).await.is_ok() {
                                     // Successfully reconnected and authenticated
-                                    *ws_writer.lock().await = Some(write);
-                                    *connection_state.lock().await = ConnectionState::Connected;
-                                    *reconnect_attempts.lock().await = 0; // Reset counter
+                                    let (outbound, outbound_rx) =
+                                        mpsc::channel::<Message>(OUTBOUND_QUEUE_SIZE);
+                                    tokio::spawn(Self::run_writer(write, outbound_rx));
+                                    *outbound_tx.write().await = Some(outbound);
+                                    connection_state
+                                        .store(ConnectionState::Connected as u8, Ordering::Relaxed);
+                                    reconnect_attempts.store(0, Ordering::Relaxed); // Reset counter
+                                    metrics.record_reconnect();
 
                                     // Continue with the new read stream
                                     read = new_read;
                                     ping_timer = tokio::time::interval(ping_interval);
                                     ping_timer.tick().await; // Skip first tick
 
+                                    // Replay the window missed while down so
+                                    // consumers see a gapless stream
+                                    if let Some(hook) = replay_hook.as_ref() {
+                                        let since = disconnected_at.load(Ordering::Relaxed);
+                                        if since > 0 {
+                                            for event in hook(since).await {
+                                                if let Some(callback) =
+                                                    event_callback.read().await.as_ref()
+                                                {
+                                                    callback(event);
+                                                    continue;
+                                                }
+                                                queue.deliver(event, &metrics).await;
+                                            }
+                                            disconnected_at.store(0, Ordering::Relaxed);
+                                        }
+                                    }
+
                                     // Reconnection successful, return to message loop
                                     'message_loop: loop {
                                         tokio::select! {
                                             msg = read.next() => {
                                                 match msg {
                                                     Some(Ok(Message::Text(text))) => {
-                                                        let _ = Self::handle_message(text, &event_tx, &last_received_seq).await;
+                                                        let _ = Self::handle_message(text, &queue, &event_callback, &event_filter, &last_received_seq, &metrics, &status_map).await;
                                                     }
                                                     Some(Ok(Message::Ping(data))) => {
-                                                        if let Some(writer) = ws_writer.lock().await.as_mut() {
-                                                            if writer.send(Message::Pong(data)).await.is_err() {
-                                                                *connection_state.lock().await = ConnectionState::Disconnected;
-                                                                *ws_writer.lock().await = None;
-                                                                break 'message_loop;
-                                                            }
+                                                        if Self::enqueue_outbound(&outbound_tx, Message::Pong(data)).await.is_err() {
+                                                            connection_state.store(ConnectionState::Disconnected as u8, Ordering::Relaxed);
+                                                            *outbound_tx.write().await = None;
+                                                            break 'message_loop;
                                                         }
                                                     }
                                                     Some(Ok(Message::Pong(_))) => {}
                                                     Some(Ok(Message::Close(_))) => {
-                                                        *connection_state.lock().await = ConnectionState::Disconnected;
-                                                        *ws_writer.lock().await = None;
+                                                        connection_state.store(ConnectionState::Disconnected as u8, Ordering::Relaxed);
+                                                        *outbound_tx.write().await = None;
                                                         break 'message_loop;
                                                     }
                                                     Some(Err(_)) => {
-                                                        *connection_state.lock().await = ConnectionState::Disconnected;
-                                                        *ws_writer.lock().await = None;
+                                                        connection_state.store(ConnectionState::Disconnected as u8, Ordering::Relaxed);
+                                                        *outbound_tx.write().await = None;
                                                         break 'message_loop;
                                                     }
                                                     None => {
-                                                        *connection_state.lock().await = ConnectionState::Disconnected;
-                                                        *ws_writer.lock().await = None;
+                                                        connection_state.store(ConnectionState::Disconnected as u8, Ordering::Relaxed);
+                                                        *outbound_tx.write().await = None;
                                                         break 'message_loop;
                                                     }
                                                     _ => {}
                                                 }
                                             }
                                             _ = ping_timer.tick() => {
-                                                if let Some(writer) = ws_writer.lock().await.as_mut() {
-                                                    if writer.send(Message::Ping(vec![])).await.is_err() {
-                                                        *connection_state.lock().await = ConnectionState::Disconnected;
-                                                        *ws_writer.lock().await = None;
-                                                        break 'message_loop;
-                                                    }
+                                                if Self::enqueue_outbound(&outbound_tx, Message::Ping(vec![])).await.is_err() {
+                                                    connection_state.store(ConnectionState::Disconnected as u8, Ordering::Relaxed);
+                                                    *outbound_tx.write().await = None;
+                                                    break 'message_loop;
                                                 }
                                             }
                                             _ = current_shutdown_rx.recv() => {
-                                                *connection_state.lock().await = ConnectionState::ShuttingDown;
-                                                *ws_writer.lock().await = None;
+                                                connection_state.store(ConnectionState::ShuttingDown as u8, Ordering::Relaxed);
+                                                *outbound_tx.write().await = None;
                                                 return; // Exit completely
                                             }
                                         }
                                     }
                                     // If we break from the inner loop, continue the reconnection loop
+                                    metrics.record_disconnect();
+                                    disconnected_at.store(Self::now_ms(), Ordering::Relaxed);
                                 }
                             }
                         }
@@ -545,24 +916,61 @@ impl WebSocketManager {
             }
 
             // Final cleanup - ensure we're marked as disconnected
-            *connection_state.lock().await = ConnectionState::Disconnected;
-            *ws_writer.lock().await = None;
+            connection_state.store(ConnectionState::Disconnected as u8, Ordering::Relaxed);
+            *outbound_tx.write().await = None;
         });
 
         Ok(())
     }
 
+    /// Extract the event type from a raw frame without parsing the JSON
+    ///
+    /// Mattermost serializes the event name as the first field, so this only
+    /// looks at a frame starting with `{"event":"..."}`. Returns None for
+    /// any other shape (auth responses, unexpected field order), in which
+    /// case the caller falls back to filtering after the full parse.
+    fn extract_event_type(text: &str) -> Option<&str> {
+        let rest = text.strip_prefix("{\"event\"")?;
+        let rest = rest.trim_start().strip_prefix(':')?;
+        let rest = rest.trim_start().strip_prefix('"')?;
+        let end = rest.find('"')?;
+        Some(&rest[..end])
+    }
+
     /// Handle an incoming WebSocket message
     async fn handle_message(
         text: String,
-        event_tx: &mpsc::Sender<PlatformEvent>,
-        last_received_seq: &Arc<Mutex<i64>>,
+        queue: &EventQueue,
+        event_callback: &Arc<RwLock<Option<EventCallback>>>,
+        event_filter: &Arc<RwLock<Option<EventFilter>>>,
+        last_received_seq: &AtomicI64,
+        metrics: &WsMetrics,
+        status_map: &RwLock<HashMap<String, UserStatus>>,
     ) -> Result<()> {
+        metrics.record_frame();
+
+        let filter_guard = event_filter.read().await;
+
+        // Cheap pre-parse drop: check the type field before deserializing
+        // the whole frame, so unwanted high-volume events (typing,
+        // status_change, ...) never pay for full JSON parsing
+        if let Some(filter) = filter_guard.as_ref() {
+            if let Some(event_type) = Self::extract_event_type(&text) {
+                if !filter.accepts_type(event_type) {
+                    return Ok(());
+                }
+            }
+        }
+
         // First, try to parse as authentication response
         // Auth responses have a different structure: {"status": "OK", "seq_reply": 1}
         if let Ok(auth_response) = serde_json::from_str::<WebSocketAuthResponse>(&text) {
             if auth_response.status == "OK" {
-                // Authentication successful - this is informational, not emitted as an event
+                // OK acknowledgements are informational and not emitted as
+                // events, but `get_statuses` responses arrive in this shape
+                // with a user_id -> status map in `data` - use them to
+                // hydrate the status map
+                Self::hydrate_status_map(&text, status_map).await;
                 return Ok(());
             } else {
                 return Err(Error::new(
@@ -576,29 +984,114 @@ impl WebSocketManager {
         }
 
         // Parse as a standard WebSocket event
-        let ws_event: WebSocketEvent = serde_json::from_str(&text).map_err(|e| {
-            Error::new(
-                ErrorCode::Unknown,
-                format!("Failed to parse WebSocket event: {e}"),
-            )
-        })?;
+        let ws_event = Self::parse_event(text)?;
 
         // Check for sequence gaps
         if ws_event.seq > 0 {
-            let mut last_seq = last_received_seq.lock().await;
-            *last_seq = ws_event.seq;
+            last_received_seq.store(ws_event.seq, Ordering::Relaxed);
+        }
+
+        // Apply the filter after parsing, covering frames the fast path
+        // could not inspect and the channel dimension (the broadcast
+        // channel is not available before deserialization)
+        if let Some(filter) = filter_guard.as_ref() {
+            if !filter.accepts_type(&ws_event.event)
+                || !filter.accepts_channel(&ws_event.broadcast.channel_id)
+            {
+                return Ok(());
+            }
         }
 
         // Convert WebSocket event to PlatformEvent
         if let Some(platform_event) = Self::convert_event(ws_event) {
-            // Try to send event to channel
-            // If full, drop the event silently (non-blocking)
-            let _ = event_tx.try_send(platform_event);
+            // Feed the local message index (a no-op unless configured)
+            match &platform_event {
+                PlatformEvent::MessagePosted(message) | PlatformEvent::MessageUpdated(message) => {
+                    crate::message_index::ingest(message);
+                }
+                _ => {}
+            }
+
+            // Keep the live status map current before delivering the event
+            if let PlatformEvent::UserStatusChanged { user_id, status } = &platform_event {
+                status_map.write().await.insert(user_id.clone(), *status);
+            }
+
+            // Push mode: deliver directly to the registered callback, bypassing the queue
+            if let Some(callback) = event_callback.read().await.as_ref() {
+                callback(platform_event);
+                return Ok(());
+            }
+
+            // Queue the event, applying the configured overflow policy when
+            // the queue is full
+            queue.deliver(platform_event, metrics).await;
         }
 
         Ok(())
     }
 
+    /// Parse a frame into a `WebSocketEvent`
+    ///
+    /// With the `simd-json` cargo feature enabled, the hot path uses the
+    /// SIMD-accelerated parser, which consumes the buffer in place;
+    /// otherwise serde_json. Both deserialize into the same structure, so
+    /// everything downstream is unaffected.
+    fn parse_event(text: String) -> Result<WebSocketEvent> {
+        #[cfg(feature = "simd-json")]
+        {
+            let mut bytes = text.into_bytes();
+            simd_json::serde::from_slice(&mut bytes).map_err(|e| {
+                Error::new(
+                    ErrorCode::Unknown,
+                    format!("Failed to parse WebSocket event: {e}"),
+                )
+            })
+        }
+        #[cfg(not(feature = "simd-json"))]
+        serde_json::from_str(&text).map_err(|e| {
+            Error::new(
+                ErrorCode::Unknown,
+                format!("Failed to parse WebSocket event: {e}"),
+            )
+        })
+    }
+
+    /// Hydrate the status map from a `get_statuses` response frame
+    ///
+    /// The response carries a `data` object mapping user IDs to status
+    /// strings. Values that do not parse to a known status are skipped, so
+    /// unrelated OK acknowledgements leave the map untouched.
+    async fn hydrate_status_map(text: &str, status_map: &RwLock<HashMap<String, UserStatus>>) {
+        let Ok(value) = serde_json::from_str::<serde_json::Value>(text) else {
+            return;
+        };
+        let Some(data) = value.get("data").and_then(|d| d.as_object()) else {
+            return;
+        };
+
+        let mut map = status_map.write().await;
+        for (user_id, status) in data {
+            if let Some(status_str) = status.as_str() {
+                let status = Self::parse_status(status_str);
+                if status != UserStatus::Unknown {
+                    map.insert(user_id.clone(), status);
+                }
+            }
+        }
+    }
+
+    /// Parse a Mattermost status string into a UserStatus
+    fn parse_status(status: &str) -> UserStatus {
+        match status {
+            "online" => UserStatus::Online,
+            "away" => UserStatus::Away,
+            "dnd" | "do_not_disturb" => UserStatus::DoNotDisturb,
+            "offline" => UserStatus::Offline,
+            _ => UserStatus::Unknown,
+        }
+    }
+
     /// Convert a Mattermost WebSocket event to a PlatformEvent
     fn convert_event(ws_event: WebSocketEvent) -> Option<PlatformEvent> {
         match ws_event.event.as_str() {
@@ -716,20 +1209,13 @@ impl WebSocketManager {
                     .and_then(|u| u.as_str())
                     .unwrap_or("")
                     .to_string();
-                let status_str = ws_event
-                    .data
-                    .get("status")
-                    .and_then(|s| s.as_str())
-                    .unwrap_or("offline");
-
-                use crate::types::user::UserStatus;
-                let status = match status_str {
-                    "online" => UserStatus::Online,
-                    "away" => UserStatus::Away,
-                    "dnd" | "do_not_disturb" => UserStatus::DoNotDisturb,
-                    "offline" => UserStatus::Offline,
-                    _ => UserStatus::Unknown,
-                };
+                let status = Self::parse_status(
+                    ws_event
+                        .data
+                        .get("status")
+                        .and_then(|s| s.as_str())
+                        .unwrap_or("offline"),
+                );
 
                 Some(PlatformEvent::UserStatusChanged { user_id, status })
             }
@@ -1298,7 +1784,7 @@ impl WebSocketManager {
     /// Disconnect from the WebSocket
     pub async fn disconnect(&mut self) {
         // Check current state before disconnecting
-        let current_state = self.get_connection_state().await;
+        let current_state = self.get_connection_state();
         if current_state == ConnectionState::ShuttingDown
             || current_state == ConnectionState::Disconnected
         {
@@ -1306,8 +1792,7 @@ impl WebSocketManager {
             return;
         }
 
-        self.set_connection_state(ConnectionState::ShuttingDown)
-            .await;
+        self.set_connection_state(ConnectionState::ShuttingDown);
         if let Some(tx) = self.shutdown_tx.take() {
             let _ = tx.send(()).await;
         }
@@ -1419,6 +1904,235 @@ mod tests {
         assert!(manager.poll_event().await.is_none());
     }
 
+    #[test]
+    fn test_extract_event_type() {
+        assert_eq!(
+            WebSocketManager::extract_event_type(r#"{"event": "typing", "data": {}}"#),
+            Some("typing")
+        );
+        assert_eq!(
+            WebSocketManager::extract_event_type(r#"{"event":"posted","data":{}}"#),
+            Some("posted")
+        );
+        // Auth responses have no event field
+        assert_eq!(
+            WebSocketManager::extract_event_type(r#"{"status": "OK", "seq_reply": 1}"#),
+            None
+        );
+        // Unexpected field order falls back to the full-parse path
+        assert_eq!(
+            WebSocketManager::extract_event_type(r#"{"data": {}, "event": "typing"}"#),
+            None
+        );
+    }
+
+    #[tokio::test]
+    async fn test_event_filter_drops_unwanted_types() {
+        let manager = WebSocketManager::new("https://mattermost.example.com", "token".to_string());
+        manager
+            .set_event_filter(Some(EventFilter {
+                event_types: ["posted".to_string()].into_iter().collect(),
+                channel_ids: HashSet::new(),
+            }))
+            .await;
+
+        let typing = r#"{"event": "typing", "data": {"user_id": "u1"}, "broadcast": {"omit_users":null,"user_id":"","channel_id":"ch1","team_id":"","connection_id":"","omit_connection_id":""}, "seq": 1}"#;
+        WebSocketManager::handle_message(
+            typing.to_string(),
+            &manager.event_queue(),
+            &manager.event_callback,
+            &manager.event_filter,
+            &manager.last_received_seq,
+            &manager.metrics,
+            &manager.status_map,
+        )
+        .await
+        .unwrap();
+
+        // Typing event was filtered out before reaching the queue
+        assert!(manager.poll_event().await.is_none());
+    }
+
+    #[tokio::test]
+    async fn test_event_filter_by_channel() {
+        let manager = WebSocketManager::new("https://mattermost.example.com", "token".to_string());
+        manager
+            .set_event_filter(Some(EventFilter {
+                event_types: HashSet::new(),
+                channel_ids: ["wanted".to_string()].into_iter().collect(),
+            }))
+            .await;
+
+        let event_for = |channel: &str| {
+            format!(
+                r#"{{"event": "typing", "data": {{"user_id": "u1"}}, "broadcast": {{"omit_users":null,"user_id":"","channel_id":"{channel}","team_id":"","connection_id":"","omit_connection_id":""}}, "seq": 1}}"#
+            )
+        };
+
+        WebSocketManager::handle_message(
+            event_for("unwanted"),
+            &manager.event_queue(),
+            &manager.event_callback,
+            &manager.event_filter,
+            &manager.last_received_seq,
+            &manager.metrics,
+            &manager.status_map,
+        )
+        .await
+        .unwrap();
+        assert!(manager.poll_event().await.is_none());
+
+        WebSocketManager::handle_message(
+            event_for("wanted"),
+            &manager.event_queue(),
+            &manager.event_callback,
+            &manager.event_filter,
+            &manager.last_received_seq,
+            &manager.metrics,
+            &manager.status_map,
+        )
+        .await
+        .unwrap();
+        assert!(matches!(
+            manager.poll_event().await,
+            Some(PlatformEvent::UserTyping { .. })
+        ));
+    }
+
+    #[tokio::test]
+    async fn test_metrics_queue_counters() {
+        let config = WebSocketConfig {
+            max_queue_size: 1,
+            ..Default::default()
+        };
+        let manager = WebSocketManager::with_config(
+            "https://mattermost.example.com",
+            "token".to_string(),
+            config,
+        );
+
+        let event_for = |seq: i64| {
+            format!(
+                r#"{{"event": "typing", "data": {{"user_id": "u1"}}, "broadcast": {{"omit_users":null,"user_id":"","channel_id":"ch1","team_id":"","connection_id":"","omit_connection_id":""}}, "seq": {seq}}}"#
+            )
+        };
+
+        // First event fills the queue; second is dropped
+        for seq in 1..=2 {
+            WebSocketManager::handle_message(
+                event_for(seq),
+                &manager.event_queue(),
+                &manager.event_callback,
+                &manager.event_filter,
+                &manager.last_received_seq,
+                &manager.metrics,
+                &manager.status_map,
+            )
+            .await
+            .unwrap();
+        }
+
+        let snapshot = manager.metrics.snapshot();
+        assert_eq!(snapshot["frames_received"], 2);
+        assert_eq!(snapshot["events_dropped"], 1);
+        assert_eq!(snapshot["events_dropped_by_type"]["user_typing"], 1);
+        assert_eq!(snapshot["queue_high_water"], 1);
+
+        manager.metrics.reset();
+        let snapshot = manager.metrics.snapshot();
+        assert_eq!(snapshot["frames_received"], 0);
+        assert_eq!(snapshot["events_dropped"], 0);
+        assert!(snapshot["events_dropped_by_type"]
+            .as_object()
+            .unwrap()
+            .is_empty());
+    }
+
+    #[tokio::test]
+    async fn test_overflow_policy_drop_oldest() {
+        let config = WebSocketConfig {
+            max_queue_size: 1,
+            ..Default::default()
+        };
+        let manager = WebSocketManager::with_config(
+            "https://mattermost.example.com",
+            "token".to_string(),
+            config,
+        );
+        manager
+            .set_overflow_policy(OverflowPolicy::DropOldest)
+            .await;
+
+        let queue = manager.event_queue();
+        for id in ["msg1", "msg2"] {
+            queue
+                .deliver(
+                    PlatformEvent::MessageDeleted {
+                        message_id: id.to_string(),
+                        channel_id: "ch1".to_string(),
+                    },
+                    &manager.metrics,
+                )
+                .await;
+        }
+
+        // The oldest event was evicted; the newest one survives
+        match manager.poll_event().await {
+            Some(PlatformEvent::MessageDeleted { message_id, .. }) => {
+                assert_eq!(message_id, "msg2");
+            }
+            other => panic!("unexpected event: {other:?}"),
+        }
+        assert!(manager.poll_event().await.is_none());
+
+        let snapshot = manager.metrics.snapshot();
+        assert_eq!(snapshot["events_dropped"], 1);
+        assert_eq!(snapshot["events_dropped_by_type"]["message_deleted"], 1);
+    }
+
+    #[tokio::test]
+    async fn test_status_map_tracks_pushes_and_hydration() {
+        let manager = WebSocketManager::new("https://mattermost.example.com", "token".to_string());
+
+        // A status_change push updates the map
+        let push = r#"{"event": "status_change", "data": {"user_id": "u1", "status": "away"}, "broadcast": {"omit_users":null,"user_id":"u1","channel_id":"","team_id":"","connection_id":"","omit_connection_id":""}, "seq": 1}"#;
+        WebSocketManager::handle_message(
+            push.to_string(),
+            &manager.event_queue(),
+            &manager.event_callback,
+            &manager.event_filter,
+            &manager.last_received_seq,
+            &manager.metrics,
+            &manager.status_map,
+        )
+        .await
+        .unwrap();
+        assert_eq!(
+            manager.status_map.read().await.get("u1"),
+            Some(&UserStatus::Away)
+        );
+
+        // A get_statuses response hydrates the map in bulk; non-status
+        // values are skipped
+        let response = r#"{"status": "OK", "seq_reply": 2, "data": {"u2": "online", "u3": "dnd", "u4": "not-a-status"}}"#;
+        WebSocketManager::handle_message(
+            response.to_string(),
+            &manager.event_queue(),
+            &manager.event_callback,
+            &manager.event_filter,
+            &manager.last_received_seq,
+            &manager.metrics,
+            &manager.status_map,
+        )
+        .await
+        .unwrap();
+
+        let map = manager.status_map.read().await;
+        assert_eq!(map.get("u2"), Some(&UserStatus::Online));
+        assert_eq!(map.get("u3"), Some(&UserStatus::DoNotDisturb));
+        assert!(!map.contains_key("u4"));
+    }
+
     #[test]
     fn test_parse_posted_event() {
         // Real data from Mattermost WebSocket
@@ -1496,7 +2210,7 @@ mod tests {
 
         // Should start in Disconnected state
         assert_eq!(
-            manager.get_connection_state().await,
+            manager.get_connection_state(),
             ConnectionState::Disconnected
         );
 
@@ -1613,11 +2327,11 @@ mod tests {
         let manager = WebSocketManager::new("https://mattermost.example.com", "token".to_string());
 
         // Should start at 0
-        assert_eq!(*manager.reconnect_attempts.lock().await, 0);
+        assert_eq!(manager.reconnect_attempts.load(Ordering::Relaxed), 0);
 
         // Reset
-        manager.reset_reconnect_attempts().await;
-        assert_eq!(*manager.reconnect_attempts.lock().await, 0);
+        manager.reset_reconnect_attempts();
+        assert_eq!(manager.reconnect_attempts.load(Ordering::Relaxed), 0);
     }
 
     #[tokio::test]
@@ -1626,12 +2340,12 @@ mod tests {
 
         // Should start in Disconnected state
         assert_eq!(
-            manager.get_connection_state().await,
+            manager.get_connection_state(),
             ConnectionState::Disconnected
         );
 
         // Verify the public API method works
-        let state = manager.get_connection_state().await;
+        let state = manager.get_connection_state();
         assert!(matches!(state, ConnectionState::Disconnected));
     }
 
@@ -7,4 +7,7 @@ mod platform_trait;
 pub mod mattermost;
 
 // Re-export platform trait and related types
-pub use platform_trait::{Platform, PlatformConfig, PlatformEvent};
+pub use platform_trait::{
+    ChunkHandler, EventCallback, OverflowPolicy, Platform, PlatformConfig, PlatformEvent,
+    ProgressHandler, SendFailureCallback,
+};
@@ -183,6 +183,99 @@ pub enum PlatformEvent {
     RoleUpdated { role_id: String },
 }
 
+impl PlatformEvent {
+    /// Stable snake_case name of the event type
+    ///
+    /// Matches the "type" field of the JSON event representation used at
+    /// the FFI boundary; also used to key per-type drop counters.
+    pub fn type_name(&self) -> &'static str {
+        match self {
+            Self::MessagePosted(_) => "message_posted",
+            Self::MessageUpdated(_) => "message_updated",
+            Self::MessageDeleted { .. } => "message_deleted",
+            Self::UserStatusChanged { .. } => "user_status_changed",
+            Self::UserTyping { .. } => "user_typing",
+            Self::ChannelCreated(_) => "channel_created",
+            Self::ChannelUpdated(_) => "channel_updated",
+            Self::ChannelDeleted { .. } => "channel_deleted",
+            Self::UserJoinedChannel { .. } => "user_joined_channel",
+            Self::UserLeftChannel { .. } => "user_left_channel",
+            Self::ConnectionStateChanged(_) => "connection_state_changed",
+            Self::ReactionAdded { .. } => "reaction_added",
+            Self::ReactionRemoved { .. } => "reaction_removed",
+            Self::DirectChannelAdded { .. } => "direct_channel_added",
+            Self::GroupChannelAdded { .. } => "group_channel_added",
+            Self::PreferenceChanged { .. } => "preference_changed",
+            Self::EphemeralMessage { .. } => "ephemeral_message",
+            Self::UserAdded { .. } => "user_added",
+            Self::UserUpdated { .. } => "user_updated",
+            Self::UserRoleUpdated { .. } => "user_role_updated",
+            Self::ChannelViewed { .. } => "channel_viewed",
+            Self::ThreadUpdated { .. } => "thread_updated",
+            Self::ThreadReadChanged { .. } => "thread_read_changed",
+            Self::ThreadFollowChanged { .. } => "thread_follow_changed",
+            Self::PostUnread { .. } => "post_unread",
+            Self::EmojiAdded { .. } => "emoji_added",
+            Self::AddedToTeam { .. } => "added_to_team",
+            Self::LeftTeam { .. } => "left_team",
+            Self::ConfigChanged => "config_changed",
+            Self::LicenseChanged => "license_changed",
+            Self::ChannelConverted { .. } => "channel_converted",
+            Self::ChannelMemberUpdated { .. } => "channel_member_updated",
+            Self::TeamDeleted { .. } => "team_deleted",
+            Self::TeamUpdated { .. } => "team_updated",
+            Self::MemberRoleUpdated { .. } => "member_role_updated",
+            Self::PluginDisabled { .. } => "plugin_disabled",
+            Self::PluginEnabled { .. } => "plugin_enabled",
+            Self::PluginStatusesChanged => "plugin_statuses_changed",
+            Self::PreferencesDeleted { .. } => "preferences_deleted",
+            Self::Response { .. } => "response",
+            Self::DialogOpened { .. } => "dialog_opened",
+            Self::RoleUpdated { .. } => "role_updated",
+        }
+    }
+}
+
+/// Policy applied when the real-time event queue is full
+///
+/// The queue is bounded (see the platform's WebSocket configuration), so a
+/// consumer that falls behind forces a choice: lose the newest event, lose
+/// the oldest, or briefly block the reader. Dropped events are counted per
+/// event type and exposed through the metrics API either way.
+#[derive(Debug, Clone, Copy, PartialEq, Eq, Default)]
+pub enum OverflowPolicy {
+    /// Discard the incoming event (default; reader never blocks)
+    #[default]
+    DropNewest,
+    /// Evict the oldest queued event to make room for the incoming one
+    DropOldest,
+    /// Block the reader up to the given duration, then drop the incoming
+    /// event; trades reader latency for fewer losses during short stalls
+    BlockWithTimeout(std::time::Duration),
+}
+
+/// Callback invoked for each event when push-mode delivery is enabled
+///
+/// The callback runs on the library's internal runtime, so implementations
+/// must be cheap and must not block.
+pub type EventCallback = std::sync::Arc<dyn Fn(PlatformEvent) + Send + Sync>;
+
+/// Callback invoked when an enqueued message terminally fails
+/// Parameters: channel_id, message text, the error
+pub type SendFailureCallback =
+    std::sync::Arc<dyn Fn(&str, &str, &crate::error::Error) + Send + Sync>;
+
+/// Handler invoked with each body chunk during a streaming download
+///
+/// Return true to continue the download or false to cancel it.
+pub type ChunkHandler = Box<dyn FnMut(&[u8]) -> bool + Send>;
+
+/// Handler invoked as a streaming upload makes progress
+///
+/// Parameters are bytes sent so far and the total file size in bytes
+/// (0 if unknown).
+pub type ProgressHandler = Box<dyn FnMut(u64, u64) + Send>;
+
 /// Trait that all platform adapters must implement
 ///
 /// This defines the common interface for interacting with different chat platforms
@@ -232,9 +325,89 @@ pub trait Platform: Send + Sync {
     /// The created message
     async fn send_message(&self, channel_id: &str, text: &str) -> Result<Message>;
 
+    /// Enqueue a message for background delivery
+    ///
+    /// Returns once the message is queued; a background task delivers it
+    /// with per-channel ordering, retrying transient failures with
+    /// backoff. Terminal failures are reported through the callback
+    /// registered with
+    /// [`set_send_failure_callback`](Self::set_send_failure_callback).
+    ///
+    /// # Arguments
+    /// * `channel_id` - The channel to send the message to
+    /// * `text` - The message text
+    async fn enqueue_message(&self, channel_id: &str, text: &str) -> Result<()> {
+        let _ = (channel_id, text);
+        Err(crate::error::Error::unsupported(
+            "Outbound message queue not supported by this platform",
+        ))
+    }
+
+    /// Register a callback for terminal outbound queue failures
+    ///
+    /// The callback runs on the library's runtime threads after a queued
+    /// message has exhausted its retries (or failed non-transiently).
+    /// Pass None to clear it.
+    async fn set_send_failure_callback(
+        &mut self,
+        callback: Option<SendFailureCallback>,
+    ) -> Result<()> {
+        let _ = callback;
+        Err(crate::error::Error::unsupported(
+            "Outbound message queue not supported by this platform",
+        ))
+    }
+
     /// Get a list of channels the user has access to
     async fn get_channels(&self) -> Result<Vec<Channel>>;
 
+    /// Get only the channels that changed since a timestamp
+    ///
+    /// # Arguments
+    /// * `since` - Timestamp in milliseconds since epoch; changes strictly
+    ///   after this point are returned. Pass a negative value to continue
+    ///   from the high-water timestamp of the previous sync (the first such
+    ///   call returns everything)
+    ///
+    /// # Returns
+    /// A [`ChannelSyncDelta`](crate::types::ChannelSyncDelta) with created,
+    /// updated, and deleted channels plus the new high-water timestamp
+    ///
+    /// # Notes
+    /// Intended for reconnect recovery: instead of re-fetching and
+    /// re-processing the full channel list, consumers apply the usually
+    /// tiny delta. The platform tracks the high-water timestamp internally
+    /// so callers do not have to persist it between calls.
+    async fn sync_channels_since(&mut self, since: i64) -> Result<crate::types::ChannelSyncDelta> {
+        let _ = since;
+        Err(crate::error::Error::unsupported(
+            "Incremental channel sync not supported by this platform",
+        ))
+    }
+
+    /// Fetch the full startup data set in one call
+    ///
+    /// Hydrates the current user, teams, channels, unread counts, and
+    /// optionally per-channel members concurrently, so clients make one
+    /// call at startup instead of dozens of sequential round trips.
+    ///
+    /// # Arguments
+    /// * `include_members` - Also fetch the member list of every channel
+    ///
+    /// # Returns
+    /// A [`BootstrapSnapshot`](crate::types::BootstrapSnapshot) with the
+    /// aggregated results
+    ///
+    /// # Notes
+    /// Per-channel member fetches are best-effort: channels whose fetch
+    /// fails are absent from the member map rather than failing the call.
+    async fn bootstrap(&self, include_members: bool) -> Result<crate::types::BootstrapSnapshot> {
+        let _ = include_members;
+        Err(crate::error::Error::unsupported(
+            "Bootstrap not supported by this platform",
+        ))
+    }
+
     /// Get details about a specific channel
     async fn get_channel(&self, channel_id: &str) -> Result<Channel>;
 
@@ -251,6 +424,27 @@ pub trait Platform: Send + Sync {
     /// Get a list of users in a channel
     async fn get_channel_members(&self, channel_id: &str) -> Result<Vec<User>>;
 
+    /// Get members for many channels in one aggregated call
+    ///
+    /// # Arguments
+    /// * `channel_ids` - The channels to fetch members for
+    ///
+    /// # Returns
+    /// A JSON string mapping each channel ID to either
+    /// `{"members": [...]}` or `{"error": {"code": ..., "message": ...}}`,
+    /// so one failing channel does not abort the batch
+    ///
+    /// # Notes
+    /// Implementations fetch the channels concurrently with bounded
+    /// parallelism, which turns hundreds of serialized round trips into a
+    /// handful of overlapping ones.
+    async fn get_channel_members_bulk(&self, channel_ids: Vec<String>) -> Result<String> {
+        let _ = channel_ids;
+        Err(crate::error::Error::unsupported(
+            "Bulk channel member fetch not supported by this platform",
+        ))
+    }
+
     /// Get details about a specific user
     async fn get_user(&self, user_id: &str) -> Result<User>;
 
@@ -378,6 +572,142 @@ pub trait Platform: Send + Sync {
     /// The user's status
     async fn get_user_status(&self, user_id: &str) -> Result<UserStatus>;
 
+    /// Get a user's status from the library-maintained status map
+    ///
+    /// # Arguments
+    /// * `user_id` - The user ID
+    ///
+    /// # Returns
+    /// The last status observed for the user, or `UserStatus::Unknown` if
+    /// no status has been seen yet
+    ///
+    /// # Notes
+    /// Answers from memory without any network I/O. The map is hydrated
+    /// once when events are subscribed and kept current from status push
+    /// events, so it is only populated while an event subscription is
+    /// active. Use `get_user_status` when a guaranteed-fresh answer is
+    /// worth an HTTP round trip.
+    async fn get_user_status_cached(&self, user_id: &str) -> Result<UserStatus> {
+        let _ = user_id;
+        Err(crate::error::Error::unsupported(
+            "Cached statuses not supported by this platform",
+        ))
+    }
+
+    /// Save the platform's cache contents to a snapshot file
+    ///
+    /// # Arguments
+    /// * `path` - Where to write the snapshot file
+    ///
+    /// # Notes
+    /// Intended to be called during shutdown so the next process start can
+    /// load the snapshot and skip the cold-start burst of API calls. Not all
+    /// platforms cache data; unsupported platforms return an error.
+    async fn save_cache_snapshot(&self, path: &std::path::Path) -> Result<()> {
+        let _ = path;
+        Err(crate::error::Error::unsupported(
+            "Cache snapshots not supported by this platform",
+        ))
+    }
+
+    /// Load the platform's cache contents from a snapshot file
+    ///
+    /// # Arguments
+    /// * `path` - The snapshot file to load
+    ///
+    /// # Notes
+    /// Loaded entries keep their remaining TTL and are revalidated lazily
+    /// against the server as they expire. Call after connect and before the
+    /// first burst of reads for a warm start.
+    async fn load_cache_snapshot(&self, path: &std::path::Path) -> Result<()> {
+        let _ = path;
+        Err(crate::error::Error::unsupported(
+            "Cache snapshots not supported by this platform",
+        ))
+    }
+
+    /// Set or clear a subscription filter for incoming events
+    ///
+    /// # Arguments
+    /// * `event_types` - Platform-native event type names to accept
+    ///   (e.g. "posted", "typing" for Mattermost), or None for all types
+    /// * `channel_ids` - Channel IDs to accept, or None for all channels
+    ///
+    /// # Notes
+    /// Filtered events are dropped as early as possible — before full
+    /// deserialization and before they occupy the event queue — so heavy
+    /// event streams (typing, status changes) cost almost nothing when
+    /// the consumer does not care about them. Events without a channel
+    /// always pass the channel filter. Pass None for both arguments to
+    /// clear the filter.
+    async fn set_event_filter(
+        &mut self,
+        event_types: Option<Vec<String>>,
+        channel_ids: Option<Vec<String>>,
+    ) -> Result<()> {
+        let _ = (event_types, channel_ids);
+        Err(crate::error::Error::unsupported(
+            "Event filters not supported by this platform",
+        ))
+    }
+
+    /// Set the backpressure policy applied when the event queue is full
+    ///
+    /// # Arguments
+    /// * `policy` - See [`OverflowPolicy`] for the available behaviors
+    ///
+    /// # Notes
+    /// Takes effect immediately on an active subscription and persists
+    /// across resubscriptions. Dropped events are counted per event type
+    /// in the metrics exposed by `get_metrics`.
+    async fn set_queue_overflow_policy(&mut self, policy: OverflowPolicy) -> Result<()> {
+        let _ = policy;
+        Err(crate::error::Error::unsupported(
+            "Queue overflow policies not supported by this platform",
+        ))
+    }
+
+    /// Get cache statistics as a JSON string
+    ///
+    /// # Returns
+    /// JSON string mapping cache names to hit, miss and eviction counters
+    /// plus the current and maximum entry counts
+    ///
+    /// # Notes
+    /// Which caches exist varies by platform. Not all platforms cache data;
+    /// unsupported platforms return an error.
+    async fn get_cache_stats(&self) -> Result<String> {
+        Err(crate::error::Error::unsupported(
+            "Cache statistics not supported by this platform",
+        ))
+    }
+
+    /// Get platform-specific runtime metrics as a JSON string
+    ///
+    /// # Returns
+    /// JSON string with connection health counters, e.g. WebSocket
+    /// reconnects, dropped events and queue depth high-water marks
+    ///
+    /// # Notes
+    /// Which counters exist varies by platform; unsupported platforms
+    /// return an error. Library-wide per-operation latency metrics are
+    /// collected separately at the FFI layer and merged there.
+    async fn get_metrics(&self) -> Result<String> {
+        Err(crate::error::Error::unsupported(
+            "Metrics not supported by this platform",
+        ))
+    }
+
+    /// Reset platform-specific runtime metrics to zero
+    ///
+    /// # Notes
+    /// Unsupported platforms return an error.
+    async fn reset_metrics(&self) -> Result<()> {
+        Err(crate::error::Error::unsupported(
+            "Metrics not supported by this platform",
+        ))
+    }
+
     /// Subscribe to real-time events (WebSocket, webhook, etc.)
     ///
     /// This method should establish a connection for receiving real-time events.
@@ -393,6 +723,22 @@ pub trait Platform: Send + Sync {
     /// Returns None if no events are available.
     async fn poll_event(&mut self) -> Result<Option<PlatformEvent>>;
 
+    /// Register a callback for push-mode event delivery
+    ///
+    /// When a callback is registered, events are delivered directly to the
+    /// callback from the library's runtime as they arrive, instead of being
+    /// queued for `poll_event`. Pass None to return to poll-based delivery.
+    ///
+    /// # Notes
+    /// The callback is invoked from a library-internal thread and must not block.
+    /// Not all platforms support push-mode delivery.
+    async fn set_event_callback(&mut self, callback: Option<EventCallback>) -> Result<()> {
+        let _ = callback;
+        Err(Error::unsupported(
+            "Push-mode event delivery not supported by this platform",
+        ))
+    }
+
     // ========================================================================
     // Extended Platform Methods
     // ========================================================================
@@ -878,6 +1224,33 @@ pub trait Platform: Send + Sync {
         ))
     }
 
+    /// Upload a file to a channel, streaming it from disk in bounded chunks
+    ///
+    /// # Arguments
+    /// * `channel_id` - The channel ID where the file will be uploaded
+    /// * `file_path` - Path to the file to upload
+    /// * `progress` - Optional handler invoked as bytes are sent
+    ///
+    /// # Returns
+    /// The file ID of the uploaded file, which can be used to attach the file to a message
+    ///
+    /// # Notes
+    /// Unlike `upload_file`, the file is never read into memory in full: the
+    /// request body is streamed from disk in bounded chunks, so memory usage
+    /// stays constant regardless of file size. Check
+    /// `capabilities().supports_file_attachments` first.
+    async fn upload_file_streaming(
+        &self,
+        channel_id: &str,
+        file_path: &std::path::Path,
+        progress: Option<ProgressHandler>,
+    ) -> Result<String> {
+        let _ = (channel_id, file_path, progress);
+        Err(crate::error::Error::unsupported(
+            "Streaming file uploads not supported by this platform",
+        ))
+    }
+
     /// Download a file by its ID
     ///
     /// # Arguments
@@ -895,6 +1268,27 @@ pub trait Platform: Send + Sync {
         ))
     }
 
+    /// Download a file by its ID, delivering the body in chunks
+    ///
+    /// # Arguments
+    /// * `file_id` - The ID of the file to download
+    /// * `handler` - Invoked with each chunk as it arrives; return false to cancel
+    ///
+    /// # Returns
+    /// Ok(()) once the whole file has been delivered
+    ///
+    /// # Notes
+    /// Unlike `download_file`, memory usage stays constant regardless of file
+    /// size: chunks are handed over as they arrive from the network instead of
+    /// being buffered. Not all platforms support file downloads. Check
+    /// `capabilities().supports_file_attachments` first.
+    async fn download_file_streaming(&self, file_id: &str, handler: ChunkHandler) -> Result<()> {
+        let _ = (file_id, handler);
+        Err(crate::error::Error::unsupported(
+            "Streaming file downloads not supported by this platform",
+        ))
+    }
+
     /// Get metadata for a file without downloading it
     ///
     /// # Arguments
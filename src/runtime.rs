@@ -37,6 +37,39 @@ pub fn init_runtime() -> crate::error::Result<()> {
     Ok(())
 }
 
+/// Initialize the async runtime with an explicit worker thread count
+///
+/// For multi-tenant processes hosting many platform handles, the default
+/// runtime sizing (one worker per core) may not match the workload; this
+/// lets the host size the thread pool explicitly. Call before
+/// `communicator_init` (e.g. through a context configured with
+/// `runtime.worker_threads`) - if a runtime already exists, this is a
+/// no-op like `init_runtime`.
+pub fn init_runtime_with_threads(worker_threads: usize) -> crate::error::Result<()> {
+    let mut runtime_guard = RUNTIME.lock().map_err(|_| {
+        crate::error::Error::new(
+            crate::error::ErrorCode::Unknown,
+            "Failed to acquire runtime lock",
+        )
+    })?;
+
+    if runtime_guard.is_none() {
+        let runtime = tokio::runtime::Builder::new_multi_thread()
+            .worker_threads(worker_threads.max(1))
+            .enable_all()
+            .build()
+            .map_err(|e| {
+                crate::error::Error::new(
+                    crate::error::ErrorCode::Unknown,
+                    format!("Failed to create Tokio runtime: {e}"),
+                )
+            })?;
+        *runtime_guard = Some(runtime);
+    }
+
+    Ok(())
+}
+
 /// Shutdown the async runtime
 ///
 /// This should be called during library cleanup.
@@ -55,6 +88,10 @@ pub fn shutdown_runtime() {
 /// This blocks the current thread until the future completes.
 /// The runtime must be initialized before calling this function.
 ///
+/// The runtime lock is only held long enough to clone the handle, never
+/// while the future runs, so callers on different threads execute
+/// concurrently instead of being serialized behind a single slow call.
+///
 /// # Panics
 /// Panics if the runtime is not initialized
 pub fn block_on<F>(future: F) -> F::Output
@@ -62,9 +99,12 @@ where
     F: Future + Send,
     F::Output: Send,
 {
-    let runtime_guard = RUNTIME.lock().expect("Failed to acquire runtime lock");
-    let runtime = runtime_guard.as_ref().expect("Runtime not initialized");
-    runtime.handle().block_on(future)
+    let handle = {
+        let runtime_guard = RUNTIME.lock().expect("Failed to acquire runtime lock");
+        let runtime = runtime_guard.as_ref().expect("Runtime not initialized");
+        runtime.handle().clone()
+    };
+    handle.block_on(future)
 }
 
 /// Get a handle to the runtime for spawning background tasks
@@ -125,6 +165,40 @@ mod tests {
         // and other tests may be using it concurrently
     }
 
+    #[test]
+    fn test_concurrent_block_on() {
+        init_runtime().expect("Failed to initialize runtime");
+
+        // Two threads blocking on sleeps must overlap: if block_on held the
+        // runtime lock for the duration of the future, they would serialize
+        // and the total elapsed time would be at least the sum of the sleeps.
+        let start = std::time::Instant::now();
+        let threads: Vec<_> = (0..2)
+            .map(|_| {
+                std::thread::spawn(|| {
+                    block_on(async {
+                        tokio::time::sleep(std::time::Duration::from_millis(100)).await;
+                    });
+                })
+            })
+            .collect();
+        for t in threads {
+            t.join().expect("Thread panicked");
+        }
+        assert!(start.elapsed() < std::time::Duration::from_millis(190));
+    }
+
+    #[test]
+    fn test_init_with_threads_is_idempotent() {
+        init_runtime().expect("Failed to initialize runtime");
+
+        // A runtime already exists, so the sized init is a no-op
+        init_runtime_with_threads(2).expect("Sized init should be a no-op");
+
+        let result = block_on(async { 1 + 1 });
+        assert_eq!(result, 2);
+    }
+
     #[test]
     fn test_multiple_init() {
         // Multiple initializations should be safe
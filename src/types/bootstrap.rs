@@ -0,0 +1,31 @@
+//! Aggregated startup snapshot types
+
+use serde::{Deserialize, Serialize};
+use std::collections::HashMap;
+
+use super::channel::{Channel, ChannelUnread};
+use super::team::Team;
+use super::user::User;
+
+/// Everything a client needs for first paint, fetched in one call
+///
+/// Returned by `Platform::bootstrap`, which hydrates the pieces
+/// concurrently instead of forcing consumers through dozens of
+/// sequential round trips on startup.
+#[derive(Debug, Clone, Serialize, Deserialize)]
+pub struct BootstrapSnapshot {
+    /// The authenticated user
+    pub current_user: User,
+    /// Teams the user belongs to
+    pub teams: Vec<Team>,
+    /// Channels on the current team
+    pub channels: Vec<Channel>,
+    /// Unread counts per channel on the current team
+    pub unreads: Vec<ChannelUnread>,
+    /// Channel ID to member list, populated when members were requested
+    ///
+    /// Channels whose member fetch failed are absent; bootstrap is
+    /// best-effort for per-channel detail so one bad channel cannot sink
+    /// the whole warm-up.
+    pub members: HashMap<String, Vec<User>>,
+}
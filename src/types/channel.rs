@@ -118,6 +118,31 @@ impl Channel {
     }
 }
 
+/// Result of an incremental channel sync
+///
+/// Produced by `Platform::sync_channels_since`: only the channels that
+/// changed since the given timestamp are included, so reconnect recovery
+/// does not have to re-process an entire workspace.
+#[derive(Debug, Clone, Serialize, Deserialize)]
+pub struct ChannelSyncDelta {
+    /// Channels created since the sync timestamp
+    pub created: Vec<Channel>,
+    /// Channels whose properties changed since the sync timestamp
+    pub updated: Vec<Channel>,
+    /// IDs of channels deleted (archived) since the sync timestamp
+    pub deleted_ids: Vec<String>,
+    /// High-water timestamp (milliseconds since epoch) covered by this
+    /// delta; pass it to the next sync call to continue from here
+    pub synced_at: i64,
+}
+
+impl ChannelSyncDelta {
+    /// Check whether the delta contains any changes
+    pub fn is_empty(&self) -> bool {
+        self.created.is_empty() && self.updated.is_empty() && self.deleted_ids.is_empty()
+    }
+}
+
 /// Unread information for a channel
 #[derive(Debug, Clone, Serialize, Deserialize)]
 pub struct ChannelUnread {
@@ -235,6 +260,23 @@ mod tests {
         assert!(!json.contains("channel_type"));
     }
 
+    #[test]
+    fn test_channel_sync_delta_is_empty() {
+        let delta = ChannelSyncDelta {
+            created: vec![],
+            updated: vec![],
+            deleted_ids: vec![],
+            synced_at: 1700000000000,
+        };
+        assert!(delta.is_empty());
+
+        let delta = ChannelSyncDelta {
+            deleted_ids: vec!["ch-1".to_string()],
+            ..delta
+        };
+        assert!(!delta.is_empty());
+    }
+
     #[test]
     fn test_channel_json_deserialization() {
         // Test that we can deserialize from JSON with "type" field
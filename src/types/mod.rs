@@ -2,6 +2,7 @@
 //!
 //! This module contains platform-agnostic types used across all platform adapters.
 
+pub mod bootstrap;
 pub mod capabilities;
 pub mod channel;
 pub mod connection;
@@ -11,8 +12,9 @@ pub mod team;
 pub mod user;
 
 // Re-export for convenience
+pub use bootstrap::BootstrapSnapshot;
 pub use capabilities::PlatformCapabilities;
-pub use channel::{Channel, ChannelType, ChannelUnread};
+pub use channel::{Channel, ChannelSyncDelta, ChannelType, ChannelUnread};
 pub use connection::{ConnectionInfo, ConnectionState};
 pub use emoji::Emoji;
 pub use message::{Attachment, Message};